@@ -0,0 +1,774 @@
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <pthread.h>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define HAVE_SSE2
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define HAVE_AVX2
+#endif
+#include "board_impl.h"
+#include "rng.h"
+
+/*============================================================================*/
+
+board_t*
+board_new(const board_params_t* params) {
+    board_t* board = calloc(1, sizeof(board_t));
+    if (!board) {
+        return NULL;
+    }
+    board->params = *params;
+    board->width = params->width;
+    board->height = params->height;
+    board->status = BOARD_PLAYING;
+
+    if (params->infinite) {
+        if (params->density < MIN_DENSITY || params->density > 100) {
+            free(board);
+            return NULL;
+        }
+        /* Infinite boards only ever hold CHUNK_CACHE chunks in memory */
+        chunkstore_t* store = &board->chunks;
+        store->cache = calloc(CHUNK_CACHE, sizeof(chunk_t));
+        store->tablecap = 4096;
+        store->table = malloc(store->tablecap * sizeof(chunkentry_t));
+        store->swap = tmpfile();
+        if (!store->cache || !store->table || !store->swap) {
+            board_free(board);
+            return NULL;
+        }
+        for (size_t i=0; i<store->tablecap; i++) {
+            store->table[i].slot = INT_MIN;     // empty
+        }
+        return board;
+    }
+
+    /* Leave at least one safe cell on the board */
+    if (params->width < 1 || params->height < 1 || params->nummines < 0 ||
+        (long long)params->nummines >= (long long)params->width * params->height) {
+        free(board);
+        return NULL;
+    }
+    board->cells = calloc((size_t)params->width * params->height, sizeof(cell_t));
+    if (!board->cells) {
+        free(board);
+        return NULL;
+    }
+    init_cell_details(board);
+    return board;
+}
+
+void
+board_free(board_t* board) {
+    if (!board) {
+        return;
+    }
+    board_unmap(board);
+    free_noguess(board);
+    free(board->cells);
+    free(board->chunks.cache);
+    free(board->chunks.table);
+    free(board->chunks.freeblocks);
+    if (board->chunks.swap) {
+        fclose(board->chunks.swap);
+    }
+    free(board->changed);
+    free(board->stack);
+    free(board->countrows);
+    free(board);
+}
+
+void
+board_reset(board_t* board, uint64_t seed) {
+    board->params.seed = seed;
+    board->generated = false;
+    board->status = BOARD_PLAYING;
+    board->numrevealed = 0;
+    board->numchanged = 0;
+    if (!board->params.infinite) {
+        memset(board->cells, 0, (size_t)board->width * board->height);
+        return;
+    }
+    /* Forget every chunk; the swap file is overwritten from the start */
+    chunkstore_t* store = &board->chunks;
+    for (int i=0; i<CHUNK_CACHE; i++) {
+        store->cache[i].live = false;
+    }
+    for (size_t i=0; i<store->tablecap; i++) {
+        store->table[i].slot = INT_MIN;
+    }
+    store->numentries = 0;
+    store->swapsize = 0;
+    store->numfree = 0;
+}
+
+size_t
+board_reveal(board_t* board, int x, int y) {
+    board->numchanged = 0;
+    cell_t* cell = board_cell(board, x, y);
+    if (!cell || (*cell & (CELL_REVEALED | CELL_FLAG))) {
+        return 0;
+    }
+    /* Mines go down on the first reveal, away from it */
+    if (!board->generated) {
+        if (board->params.noguess && !board->params.infinite) {
+            generate_noguess(board, x, y);
+        } else {
+            generate_mines(board, x, y);
+            if (!board->params.infinite) {
+                generate_touching_details(board);
+            }
+        }
+    }
+    /* Reveal the cell and any empty region behind it */
+    clear_zeros(board, x, y);
+    return board->numchanged;
+}
+
+size_t
+board_flag(board_t* board, int x, int y) {
+    /* Flag/unflag a hidden cell */
+    board->numchanged = 0;
+    cell_t* cell = board_cell(board, x, y);
+    if (!cell || (*cell & CELL_REVEALED)) {
+        return 0;
+    }
+    *cell ^= CELL_FLAG;
+    push_coord(&board->changed, &board->numchanged, &board->capchanged, (coord_t){x, y});
+    return board->numchanged;
+}
+
+size_t
+board_chord(board_t* board, int x, int y) {
+    /* On a revealed number with that many flags around it, reveal every
+     * other hidden neighbour at once */
+    board->numchanged = 0;
+    cell_t* cell = board_cell(board, x, y);
+    if (!cell || !(*cell & CELL_REVEALED) || (*cell & CELL_MINE)) {
+        return 0;
+    }
+    int count = *cell & CELL_COUNT;
+    int flags = 0;
+    for (int dy=-1; dy<=1; dy++) {
+        for (int dx=-1; dx<=1; dx++) {
+            cell_t* n = board_cell(board, x+dx, y+dy);
+            if (n && (*n & CELL_FLAG)) {
+                flags++;
+            }
+        }
+    }
+    if (count == 0 || flags != count) {
+        return 0;
+    }
+    for (int dy=-1; dy<=1; dy++) {
+        for (int dx=-1; dx<=1; dx++) {
+            cell_t* n = board_cell(board, x+dx, y+dy);
+            if (n && !(*n & (CELL_REVEALED | CELL_FLAG))) {
+                clear_zeros(board, x+dx, y+dy);
+            }
+        }
+    }
+    return board->numchanged;
+}
+
+const coord_t*
+board_changes(const board_t* board, size_t* num) {
+    *num = board->numchanged;
+    return board->changed;
+}
+
+const board_params_t*
+board_params(const board_t* board) {
+    return &board->params;
+}
+
+board_status_t
+board_status(const board_t* board) {
+    return board->status;
+}
+
+bool
+board_generated(const board_t* board) {
+    return board->generated;
+}
+
+cell_t*
+board_cell(board_t* board, int x, int y) {
+    /* Returns the cell at (x,y), building its chunk if needed, or NULL past
+     * the board's edge. The pointer is only valid until the next lookup:
+     * on infinite boards that lookup may evict the chunk it points into. */
+    if (!board->params.infinite) {
+        if (x<0 || x>=board->width || y<0 || y>=board->height) {
+            return NULL;
+        }
+        return &board->cells[(size_t)y*board->width + x];
+    }
+    if (x < -CHUNK_LIMIT || x >= CHUNK_LIMIT || y < -CHUNK_LIMIT || y >= CHUNK_LIMIT) {
+        return NULL;
+    }
+    chunk_t* chunk = chunk_get(board, x >> CHUNK_SHIFT, y >> CHUNK_SHIFT, true);
+    return &chunk->cells[(y & (CHUNK_SIZE-1)) * CHUNK_SIZE + (x & (CHUNK_SIZE-1))];
+}
+
+cell_t
+board_peek(board_t* board, int x, int y) {
+    /* Like board_cell but read only: chunks nobody has touched are all
+     * hidden cells, so drawing them never builds anything. Cells past the
+     * edge read as hidden too. */
+    if (!board->params.infinite) {
+        if (x<0 || x>=board->width || y<0 || y>=board->height) {
+            return 0;
+        }
+        return board->cells[(size_t)y*board->width + x];
+    }
+    if (x < -CHUNK_LIMIT || x >= CHUNK_LIMIT || y < -CHUNK_LIMIT || y >= CHUNK_LIMIT) {
+        return 0;
+    }
+    chunk_t* chunk = chunk_get(board, x >> CHUNK_SHIFT, y >> CHUNK_SHIFT, false);
+    if (!chunk) {
+        return 0;
+    }
+    return chunk->cells[(y & (CHUNK_SIZE-1)) * CHUNK_SIZE + (x & (CHUNK_SIZE-1))];
+}
+
+bool
+chunk_mine(const board_t* board, int x, int y) {
+    /* Stateless: a cell is a mine when a hash of (seed, x, y) falls under
+     * the density, so any chunk can be rebuilt exactly at any time */
+    if (board->generated && llabs((long long)x - board->safex) <= 1 && llabs((long long)y - board->safey) <= 1) {
+        return false;
+    }
+    uint64_t z = board->params.seed ^ ((uint64_t)(uint32_t)x * 0x9E3779B97F4A7C15ull)
+                             ^ ((uint64_t)(uint32_t)y * 0xC2B2AE3D27D4EB4Full);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    z ^= z >> 31;
+    return (z % 100) < (uint64_t)board->params.density;
+}
+
+static size_t
+chunk_home(const chunkstore_t* store, int cx, int cy) {
+    /* Slot where the probe for (cx,cy) starts */
+    uint64_t h = ((uint64_t)(uint32_t)cx << 32 | (uint32_t)cy) * 0x9E3779B97F4A7C15ull;
+    return (size_t)(h >> 32) & (store->tablecap - 1);
+}
+
+static void
+push_block(chunkstore_t* store, long delta) {
+    /* Hands a swap block back for the next chunk that needs one */
+    if (store->numfree == store->capfree) {
+        size_t newcap = store->capfree ? store->capfree * 2 : 64;
+        long* grown = realloc(store->freeblocks, newcap * sizeof(long));
+        if (!grown) {
+            printf("Error growing swap free list to %zu blocks\n", newcap);
+            exit(EXIT_FAILURE);
+        }
+        store->freeblocks = grown;
+        store->capfree = newcap;
+    }
+    store->freeblocks[store->numfree++] = delta;
+}
+
+chunkentry_t*
+chunk_find(chunkstore_t* store, int cx, int cy, bool insert) {
+    /* Linear probing on a hash of the chunk coordinates. chunk_forget
+     * shifts entries back over the hole it leaves, so there are no
+     * tombstones. */
+    if (insert && (store->numentries + 1) * 2 > store->tablecap) {
+        chunkentry_t* old = store->table;
+        size_t oldcap = store->tablecap;
+        chunkentry_t* table = malloc(oldcap * 2 * sizeof(chunkentry_t));
+        if (!table) {
+            printf("Error growing chunk index to %zu entries\n", oldcap * 2);
+            exit(EXIT_FAILURE);
+        }
+        store->table = table;
+        store->tablecap = oldcap * 2;
+        store->numentries = 0;
+        for (size_t i=0; i<store->tablecap; i++) {
+            store->table[i].slot = INT_MIN;
+        }
+        for (size_t i=0; i<oldcap; i++) {
+            if (old[i].slot != INT_MIN) {
+                *chunk_find(store, old[i].cx, old[i].cy, true) = old[i];
+            }
+        }
+        free(old);
+    }
+    size_t i = chunk_home(store, cx, cy);
+    while (store->table[i].slot != INT_MIN) {
+        if (store->table[i].cx == cx && store->table[i].cy == cy) {
+            return &store->table[i];
+        }
+        i = (i + 1) & (store->tablecap - 1);
+    }
+    if (!insert) {
+        return NULL;
+    }
+    store->table[i] = (chunkentry_t){cx, cy, -1, -1};
+    store->numentries++;
+    return &store->table[i];
+}
+
+void
+chunk_forget(chunkstore_t* store, chunkentry_t* entry) {
+    /* Removes entry, moving later entries of the same probe run back into
+     * the hole unless that would put them before their home slot. Other
+     * entry pointers may move. */
+    size_t mask = store->tablecap - 1;
+    size_t hole = (size_t)(entry - store->table);
+    for (size_t j=(hole + 1) & mask; store->table[j].slot != INT_MIN; j=(j + 1) & mask) {
+        size_t home = chunk_home(store, store->table[j].cx, store->table[j].cy);
+        if (((j - home) & mask) >= ((j - hole) & mask)) {
+            store->table[hole] = store->table[j];
+            hole = j;
+        }
+    }
+    store->table[hole].slot = INT_MIN;
+    store->numentries--;
+}
+
+chunk_t*
+chunk_get(board_t* board, int cx, int cy, bool create) {
+    /* Returns the live chunk at (cx,cy), bringing it back from its saved
+     * state or building it fresh. Without create, chunks that were never
+     * touched are not built and NULL is returned instead. */
+    chunkstore_t* store = &board->chunks;
+    chunkentry_t* entry = chunk_find(store, cx, cy, false);
+    store->tick++;
+    if (entry && entry->slot >= 0) {
+        store->cache[entry->slot].lastuse = store->tick;
+        return &store->cache[entry->slot];
+    }
+    if (!create && (!entry || entry->delta < 0)) {
+        return NULL;
+    }
+    if (!entry) {
+        entry = chunk_find(store, cx, cy, true);
+    }
+
+    /* Take a free slot, or evict the least recently used chunk */
+    int slot = 0;
+    for (int i=0; i<CHUNK_CACHE; i++) {
+        if (!store->cache[i].live) {
+            slot = i;
+            break;
+        }
+        if (store->cache[i].lastuse < store->cache[slot].lastuse) {
+            slot = i;
+        }
+    }
+    chunk_t* chunk = &store->cache[slot];
+    if (chunk->live) {
+        /* May forget the evicted chunk and move this one's entry */
+        chunk_evict(board, chunk);
+        entry = chunk_find(store, cx, cy, false);
+    }
+    chunk->cx = cx;
+    chunk->cy = cy;
+    chunk->live = true;
+    chunk->lastuse = store->tick;
+    memset(chunk->cells, 0, sizeof(chunk->cells));
+
+    /* Restore what the player did here before it went cold */
+    if (entry->delta >= 0) {
+        uint8_t bits[CHUNK_CELLS/4];
+        if (fseek(store->swap, entry->delta, SEEK_SET) ||
+            fread(bits, sizeof(bits), 1, store->swap) != 1) {
+            printf("Error reading chunk (%d, %d) from swap\n", cx, cy);
+            exit(EXIT_FAILURE);
+        }
+        for (int i=0; i<CHUNK_CELLS; i++) {
+            if (bits[i >> 3] & (1 << (i & 7))) {
+                chunk->cells[i] |= CELL_REVEALED;
+            }
+            if (bits[CHUNK_CELLS/8 + (i >> 3)] & (1 << (i & 7))) {
+                chunk->cells[i] |= CELL_FLAG;
+            }
+        }
+    }
+    chunk_fill(board, chunk);
+    entry->slot = slot;
+    return chunk;
+}
+
+void
+chunk_evict(board_t* board, chunk_t* chunk) {
+    /* Saves the chunk's revealed/flag bits, everything else is rebuilt from
+     * the seed when it is next needed */
+    chunkstore_t* store = &board->chunks;
+    chunkentry_t* entry = chunk_find(store, chunk->cx, chunk->cy, false);
+    uint8_t bits[CHUNK_CELLS/4] = {0};
+    bool touched = false;
+
+    for (int i=0; i<CHUNK_CELLS; i++) {
+        if (chunk->cells[i] & CELL_REVEALED) {
+            bits[i >> 3] |= 1 << (i & 7);
+            touched = true;
+        }
+        if (chunk->cells[i] & CELL_FLAG) {
+            bits[CHUNK_CELLS/8 + (i >> 3)] |= 1 << (i & 7);
+            touched = true;
+        }
+    }
+    chunk->live = false;
+    if (!touched) {
+        /* Nothing to keep: it is rebuilt from the seed if seen again */
+        if (entry->delta >= 0) {
+            push_block(store, entry->delta);
+        }
+        chunk_forget(store, entry);
+        return;
+    }
+    if (entry->delta < 0) {
+        if (store->numfree > 0) {
+            entry->delta = store->freeblocks[--store->numfree];
+        } else {
+            entry->delta = store->swapsize;
+            store->swapsize += sizeof(bits);
+        }
+    }
+    if (fseek(store->swap, entry->delta, SEEK_SET) ||
+        fwrite(bits, sizeof(bits), 1, store->swap) != 1) {
+        printf("Error writing chunk (%d, %d) to swap\n", chunk->cx, chunk->cy);
+        exit(EXIT_FAILURE);
+    }
+    entry->slot = -1;
+}
+
+
+void
+generate_mines(board_t* board, int safex, int safey) {
+    /* Places exactly board->params.nummines mines, never inside the 3x3 square
+     * around (safex,safey) so the first click always opens. If the board is
+     * too full for that, only the clicked cell itself is kept safe. The
+     * mine bit in the cell store doubles as the sampling bitmap: cells are
+     * drawn at random and redrawn on collision. The sampled set is kept at
+     * most half of the free cells (placing the safe cells instead on dense
+     * boards), so this runs in expected O(cells). */
+    if (board->params.infinite) {
+        /* Mines come from chunk_mine, so just clear the square and rebuild
+         * the chunks that were built (for flags) before it was known */
+        board->safex = safex;
+        board->safey = safey;
+        board->generated = true;
+        for (int i=0; i<CHUNK_CACHE; i++) {
+            if (board->chunks.cache[i].live) {
+                chunk_fill(board, &board->chunks.cache[i]);
+            }
+        }
+        return;
+    }
+    size_t n = (size_t)board->width * board->height;
+    int reach = 1;
+    size_t numsafe = (size_t)(MIN(safex+1, board->width-1) - MAX(safex-1, 0) + 1) *
+                     (MIN(safey+1, board->height-1) - MAX(safey-1, 0) + 1);
+    if ((size_t)board->params.nummines > n - numsafe) {
+        reach = 0;
+        numsafe = 1;
+    }
+    size_t numfree = n - numsafe;
+    size_t target = board->params.nummines;
+    cell_t mark = CELL_MINE;
+    rng_t rng;
+
+    rng_seed(&rng, board->params.seed);
+    for (size_t i=0; i<n; i++) {
+        board->cells[i] &= ~CELL_MINE;
+    }
+    if (target > numfree / 2) {
+        /* Dense board: mark everything as a mine, then carve out the gaps */
+        for (size_t i=0; i<n; i++) {
+            board->cells[i] |= CELL_MINE;
+        }
+        target = numfree - target;
+        mark = 0;
+    }
+    for (int y=MAX(safey-reach, 0); y<=MIN(safey+reach, board->height-1); y++) {
+        for (int x=MAX(safex-reach, 0); x<=MIN(safex+reach, board->width-1); x++) {
+            board->cells[(size_t)y*board->width + x] &= ~CELL_MINE;
+        }
+    }
+
+    while (target > 0) {
+        size_t i = rng_below(&rng, n);
+        int x = (int)(i % board->width);
+        int y = (int)(i / board->width);
+        /* Skip cells already sampled and the protected square */
+        if ((board->cells[i] & CELL_MINE) == mark ||
+            (abs(x - safex) <= reach && abs(y - safey) <= reach)) {
+            continue;
+        }
+        board->cells[i] ^= CELL_MINE;
+        target--;
+    }
+    board->generated = true;
+}
+
+void
+init_cell_details(board_t* board) {
+    /* Loop through all cells, keeping only the mine bit. Positions are
+     * derived from the cell index so nothing else needs to be stored. */
+    if (board->params.infinite) {
+        return;     // chunks start out hidden
+    }
+    size_t n = (size_t)board->width * board->height;
+    for (size_t i=0; i<n; i++) {
+        board->cells[i] &= CELL_MINE;
+    }
+    generate_touching_details(board);
+}
+
+/* Row kernels for generate_touching_details. Each adds byte rows lane by
+ * lane; sums never exceed 8 so nothing can overflow a byte. */
+static void
+sum3_rows_scalar(uint8_t* out, const uint8_t* a, const uint8_t* b, const uint8_t* c, int n) {
+    for (int x=0; x<n; x++) {
+        out[x] = a[x] + b[x] + c[x];
+    }
+}
+
+static void
+sum4_rows_scalar(uint8_t* out, const uint8_t* a, const uint8_t* b, const uint8_t* c, const uint8_t* d, int n) {
+    for (int x=0; x<n; x++) {
+        out[x] = a[x] + b[x] + c[x] + d[x];
+    }
+}
+
+#ifdef HAVE_SSE2
+static void
+sum3_rows_sse2(uint8_t* out, const uint8_t* a, const uint8_t* b, const uint8_t* c, int n) {
+    int x = 0;
+    for (; x+16<=n; x+=16) {
+        __m128i s = _mm_add_epi8(_mm_loadu_si128((const __m128i*)(a+x)), _mm_loadu_si128((const __m128i*)(b+x)));
+        s = _mm_add_epi8(s, _mm_loadu_si128((const __m128i*)(c+x)));
+        _mm_storeu_si128((__m128i*)(out+x), s);
+    }
+    sum3_rows_scalar(out+x, a+x, b+x, c+x, n-x);
+}
+
+static void
+sum4_rows_sse2(uint8_t* out, const uint8_t* a, const uint8_t* b, const uint8_t* c, const uint8_t* d, int n) {
+    int x = 0;
+    for (; x+16<=n; x+=16) {
+        __m128i s = _mm_add_epi8(_mm_loadu_si128((const __m128i*)(a+x)), _mm_loadu_si128((const __m128i*)(b+x)));
+        __m128i t = _mm_add_epi8(_mm_loadu_si128((const __m128i*)(c+x)), _mm_loadu_si128((const __m128i*)(d+x)));
+        _mm_storeu_si128((__m128i*)(out+x), _mm_add_epi8(s, t));
+    }
+    sum4_rows_scalar(out+x, a+x, b+x, c+x, d+x, n-x);
+}
+#endif
+
+#ifdef HAVE_AVX2
+__attribute__((target("avx2"))) static void
+sum3_rows_avx2(uint8_t* out, const uint8_t* a, const uint8_t* b, const uint8_t* c, int n) {
+    int x = 0;
+    for (; x+32<=n; x+=32) {
+        __m256i s = _mm256_add_epi8(_mm256_loadu_si256((const __m256i*)(a+x)), _mm256_loadu_si256((const __m256i*)(b+x)));
+        s = _mm256_add_epi8(s, _mm256_loadu_si256((const __m256i*)(c+x)));
+        _mm256_storeu_si256((__m256i*)(out+x), s);
+    }
+    sum3_rows_scalar(out+x, a+x, b+x, c+x, n-x);
+}
+
+__attribute__((target("avx2"))) static void
+sum4_rows_avx2(uint8_t* out, const uint8_t* a, const uint8_t* b, const uint8_t* c, const uint8_t* d, int n) {
+    int x = 0;
+    for (; x+32<=n; x+=32) {
+        __m256i s = _mm256_add_epi8(_mm256_loadu_si256((const __m256i*)(a+x)), _mm256_loadu_si256((const __m256i*)(b+x)));
+        __m256i t = _mm256_add_epi8(_mm256_loadu_si256((const __m256i*)(c+x)), _mm256_loadu_si256((const __m256i*)(d+x)));
+        _mm256_storeu_si256((__m256i*)(out+x), _mm256_add_epi8(s, t));
+    }
+    sum4_rows_scalar(out+x, a+x, b+x, c+x, d+x, n-x);
+}
+#endif
+
+static void (*sum3_rows)(uint8_t*, const uint8_t*, const uint8_t*, const uint8_t*, int);
+static void (*sum4_rows)(uint8_t*, const uint8_t*, const uint8_t*, const uint8_t*, const uint8_t*, int);
+static pthread_once_t kernels_once = PTHREAD_ONCE_INIT;
+
+static void
+pick_kernels(void) {
+    /* The widest row kernels this CPU supports */
+    sum3_rows = sum3_rows_scalar;
+    sum4_rows = sum4_rows_scalar;
+#ifdef HAVE_SSE2
+    sum3_rows = sum3_rows_sse2;
+    sum4_rows = sum4_rows_sse2;
+#endif
+#ifdef HAVE_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        sum3_rows = sum3_rows_avx2;
+        sum4_rows = sum4_rows_avx2;
+    }
+#endif
+}
+
+static void
+select_kernels(void) {
+    /* Boards on several threads may count at once; pthread_once makes
+     * both pointers visible to every caller before any of them is used */
+    pthread_once(&kernels_once, pick_kernels);
+}
+
+void
+generate_touching_details(board_t* board) {
+    /* Counts are built from byte planes rather than per-cell bounds checks.
+     * Each board row is unpacked into a mine row padded with a zero on
+     * both ends, and each padded row is summed into horizontal triples.
+     * A cell's count is then the triples above and below plus its left and
+     * right neighbours. Rows past the top and bottom edges are all zero, so
+     * no cell needs a bounds branch. Only three rows of each plane are kept,
+     * so the scratch space is O(width) whatever the board height. It is
+     * kept on the board, so a new game reuses it. */
+    select_kernels();
+    int w = board->width;
+    size_t size = (size_t)7*w + 6;
+    if (board->capcountrows < size) {
+        uint8_t* grown = realloc(board->countrows, size);
+        if (!grown) {
+            printf("Error allocating count rows for width %d\n", w);
+            exit(EXIT_FAILURE);
+        }
+        board->countrows = grown;
+        board->capcountrows = size;
+    }
+    uint8_t* scratch = board->countrows;
+    memset(scratch, 0, size);
+    uint8_t* mines[3] = {scratch, scratch + (w+2), scratch + 2*(w+2)};
+    uint8_t* triples[3] = {scratch + 3*(w+2), scratch + 3*(w+2) + w, scratch + 3*(w+2) + 2*w};
+    uint8_t* counts = scratch + 3*(w+2) + 3*w;
+    int prev = 0, cur = 1, next = 2;
+
+    /* Row above the board stays zero; unpack row 0 */
+    for (int x=0; x<w; x++) {
+        mines[cur][x+1] = (board->cells[x] & CELL_MINE) >> 6;
+    }
+    sum3_rows(triples[cur], mines[cur], mines[cur]+1, mines[cur]+2, w);
+
+    for (int y=0; y<board->height; y++) {
+        cell_t* row = &board->cells[(size_t)y*w];
+        /* Unpack the row below, or zeros past the bottom edge */
+        if (y+1 < board->height) {
+            for (int x=0; x<w; x++) {
+                mines[next][x+1] = (row[w+x] & CELL_MINE) >> 6;
+            }
+        } else {
+            memset(mines[next], 0, w+2);
+        }
+        sum3_rows(triples[next], mines[next], mines[next]+1, mines[next]+2, w);
+
+        sum4_rows(counts, triples[prev], triples[next], mines[cur], mines[cur]+2, w);
+        for (int x=0; x<w; x++) {
+            row[x] = (row[x] & ~CELL_COUNT) | counts[x];
+        }
+
+        int t = prev;
+        prev = cur;
+        cur = next;
+        next = t;
+    }
+}
+
+void
+chunk_fill(board_t* board, chunk_t* chunk) {
+    /* Rebuilds a chunk's mine and count bits, keeping revealed/flag. The
+     * mine plane is padded with the neighbouring chunks' edge cells, which
+     * are hashed directly, so counts are right across chunk edges without
+     * building the neighbours. */
+    uint8_t mines[CHUNK_SIZE+2][CHUNK_SIZE+2];
+    uint8_t triples[CHUNK_SIZE+2][CHUNK_SIZE];
+    uint8_t counts[CHUNK_SIZE];
+    int x0 = chunk->cx * CHUNK_SIZE - 1;
+    int y0 = chunk->cy * CHUNK_SIZE - 1;
+
+    select_kernels();
+    for (int y=0; y<CHUNK_SIZE+2; y++) {
+        for (int x=0; x<CHUNK_SIZE+2; x++) {
+            mines[y][x] = chunk_mine(board, x0 + x, y0 + y);
+        }
+        sum3_rows(triples[y], mines[y], mines[y]+1, mines[y]+2, CHUNK_SIZE);
+    }
+    for (int y=0; y<CHUNK_SIZE; y++) {
+        cell_t* row = &chunk->cells[y*CHUNK_SIZE];
+        sum4_rows(counts, triples[y], triples[y+2], mines[y+1], mines[y+1]+2, CHUNK_SIZE);
+        for (int x=0; x<CHUNK_SIZE; x++) {
+            row[x] = (row[x] & (CELL_REVEALED | CELL_FLAG)) | (mines[y+1][x+1] << 6) | counts[x];
+        }
+    }
+}
+
+
+void
+push_coord(coord_t** list, size_t* num, size_t* cap, coord_t c) {
+    /* Grow the list geometrically so pushes are amortised O(1) */
+    if (*num == *cap) {
+        size_t newcap = *cap ? *cap * 2 : 256;
+        coord_t* grown = realloc(*list, newcap * sizeof(coord_t));
+        if (!grown) {
+            printf("Error growing coordinate list to %zu entries\n", newcap);
+            exit(EXIT_FAILURE);
+        }
+        *list = grown;
+        *cap = newcap;
+    }
+    (*list)[(*num)++] = c;
+}
+
+void
+clear_zeros(board_t* board, int x, int y) {
+    /* Reveals (x,y) and flood fills outwards over connected zero cells.
+     * Each cell enters the stack at most once, so a reveal costs
+     * O(size of the revealed region). Every cell revealed is appended to
+     * board->changed. */
+    size_t top = 0;
+
+    cell_t* cell = board_cell(board, x, y);
+    if (*cell & CELL_REVEALED) {
+        return;
+    }
+    *cell |= CELL_REVEALED;
+    push_coord(&board->changed, &board->numchanged, &board->capchanged, (coord_t){x, y});
+    if (*cell & CELL_MINE) {
+        board->status = BOARD_LOST;
+        return;
+    }
+    board->numrevealed++;
+
+    /* Only an empty cell spreads to its neighbours */
+    if (!(*cell & CELL_COUNT)) {
+        push_coord(&board->stack, &top, &board->capstack, (coord_t){x, y});
+    }
+
+    while (top > 0) {
+        coord_t c = board->stack[--top];
+        /* Check all 8 cells around this one */
+        for (int dy=-1; dy<=1; dy++) {
+            for (int dx=-1; dx<=1; dx++) {
+                int nx = c.x + dx;
+                int ny = c.y + dy;
+                cell_t* n = board_cell(board, nx, ny);
+                /* MAKE SURE TO NOT CLICK MINES !! (or flagged cells) */
+                if (!n || (*n & (CELL_REVEALED | CELL_FLAG | CELL_MINE))) {
+                    continue;
+                }
+                *n |= CELL_REVEALED;
+                board->numrevealed++;
+                push_coord(&board->changed, &board->numchanged, &board->capchanged, (coord_t){nx, ny});
+                if (!(*n & CELL_COUNT)) {
+                    push_coord(&board->stack, &top, &board->capstack, (coord_t){nx, ny});
+                }
+            }
+        }
+    }
+
+    /* Every safe cell open wins, infinite boards never run out */
+    if (!board->params.infinite && board->status == BOARD_PLAYING &&
+        board->numrevealed == (size_t)board->width * board->height - board->params.nummines) {
+        board->status = BOARD_WON;
+    }
+}
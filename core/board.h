@@ -0,0 +1,82 @@
+#ifndef BOARD_H
+#define BOARD_H
+
+/* Headless minesweeper core. Everything here is plain C with no SDL, so
+ * the game can be driven by the SDL front end, simulators, solvers or
+ * servers alike. A board_t is an opaque handle; every move returns the
+ * cells it changed. */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* A cell is packed into a single byte: the low nibble holds the number of
+ * touching mines (0-8) and the high bits hold its state. */
+#define CELL_COUNT (0x0F)
+#define CELL_REVEALED (0x10)
+#define CELL_FLAG (0x20)
+#define CELL_MINE (0x40)
+#define CELL_STATES (0x80)  // number of distinct packed cell values
+
+#define CHUNK_LIMIT (1 << 30)   // infinite boards span [-limit, limit) cells each way
+#define MIN_DENSITY (15)    // below this, empty regions may never close
+
+typedef uint8_t cell_t;
+
+typedef struct {
+    int x, y;
+} coord_t;
+
+typedef struct {
+    int width;          // number of cells x-dir
+    int height;         // number of cells y-dir
+    int nummines;       // number of mines on the board
+    uint64_t seed;      // seed for mine placement, same seed gives same board
+    bool infinite;      // unbounded board built from chunks on demand
+    int density;        // infinite boards: percent of cells that are mines
+    bool noguess;       // fixed boards: only layouts the solver finishes from the first click
+    int threads;        // no-guess boards: threads searching for a layout
+} board_params_t;
+
+typedef enum {
+    BOARD_PLAYING,
+    BOARD_WON,
+    BOARD_LOST,
+} board_status_t;
+
+typedef struct board board_t;
+
+/* Returns a new board with no mines placed yet, or NULL if the parameters
+ * are invalid or memory runs out. Mines are placed by the first reveal,
+ * away from it, so the same seed and first click give the same board. */
+board_t* board_new(const board_params_t* params);
+void board_free(board_t* board);
+/* Starts a new game with another seed, reusing the board's memory */
+void board_reset(board_t* board, uint64_t seed);
+
+/* Save files hold the packed cells in page-aligned row-major form behind a
+ * one page header, and are mapped to serve as the board's cell store. A
+ * saved or loaded board keeps using its file: moves reach it as the OS
+ * writes pages back, board_save forces out only the dirty pages, and
+ * board_free closes it cleanly. Fixed boards only; returns false or NULL
+ * if the file cannot be written or read. A failed load leaves the file
+ * untouched and sets errno: ENOENT if it does not exist, EINVAL if it is
+ * not a save this version can read. */
+bool board_save(board_t* board, const char* path);
+board_t* board_load(const char* path);
+
+/* Moves. Each returns the number of cells it changed; the cells are
+ * listed by board_changes until the next move. Moves still apply after
+ * the game is lost; the status stays BOARD_LOST. */
+size_t board_reveal(board_t* board, int x, int y);
+size_t board_flag(board_t* board, int x, int y);
+size_t board_chord(board_t* board, int x, int y);
+const coord_t* board_changes(const board_t* board, size_t* num);
+
+/* Queries */
+const board_params_t* board_params(const board_t* board);
+board_status_t board_status(const board_t* board);
+bool board_generated(const board_t* board);
+cell_t board_peek(board_t* board, int x, int y);
+
+#endif
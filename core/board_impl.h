@@ -0,0 +1,93 @@
+#ifndef BOARD_IMPL_H
+#define BOARD_IMPL_H
+
+/* Internals of board_t, shared by the core modules only. Front ends go
+ * through board.h. */
+
+#include <stdio.h>
+#include "board.h"
+
+#define CHUNK_SHIFT (6)     // infinite boards are built from 64x64 chunks
+#define CHUNK_SIZE (1 << CHUNK_SHIFT)
+#define CHUNK_CELLS (CHUNK_SIZE*CHUNK_SIZE)
+#define CHUNK_CACHE (1024)  // live chunks kept in memory, 4 KiB each
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+/* A live chunk of an infinite board. Chunks are rebuilt from the seed
+ * whenever they are needed; only their revealed/flag bits are saved. */
+typedef struct {
+    int cx, cy;         // chunk coordinates, cell (x,y) is in (x>>6, y>>6)
+    bool live;
+    uint64_t lastuse;   // tick of the last lookup, oldest is evicted first
+    cell_t cells[CHUNK_CELLS];
+} chunk_t;
+
+typedef struct {
+    int cx, cy;
+    int slot;           // index into the cache, -1 when not live
+    long delta;         // offset of its saved state in the swap file, -1 if none
+} chunkentry_t;
+
+/* Memory is bounded by what the player changed, not by how far they
+ * looked: the index holds the live chunks plus the cold chunks with
+ * revealed or flagged cells, and the swap file one block per such chunk.
+ * Chunks only viewed are forgotten when evicted, and blocks of chunks
+ * whose last flag was removed are reused. */
+typedef struct {
+    chunk_t* cache;     // CHUNK_CACHE live chunks
+    chunkentry_t* table;    // open addressing index of live and changed chunks
+    size_t tablecap, numentries;
+    FILE* swap;         // revealed/flag bits of chunks that went cold
+    long swapsize;
+    long* freeblocks;   // swap offsets no chunk uses any more
+    size_t numfree, capfree;
+    uint64_t tick;
+} chunkstore_t;
+
+struct board {
+    board_params_t params;
+    int width, height;  // copies of params, read on every cell lookup
+    bool generated;     // mines are placed on the first reveal
+    board_status_t status;
+    size_t numrevealed; // revealed cells that are not mines
+    cell_t* cells;      // fixed boards: width*height packed cells, row-major
+    int safex, safey;   // infinite boards: first revealed cell, kept clear
+    chunkstore_t chunks;    // infinite boards: cell storage
+    coord_t* changed;   // cells changed by the last move
+    size_t numchanged, capchanged;
+    coord_t* stack;     // flood fill work list, kept between moves
+    size_t capstack;
+    uint8_t* countrows; // generate_touching_details scratch, kept between games
+    size_t capcountrows;
+    void* map;          // saved boards: the mapped file, cells point into it
+    size_t mapsize;
+    char* path;         // file the board is mapped from
+    board_t* scratch;   // no-guess boards: the search board, solver and
+    struct solver* solver;  // layout of the generating thread, kept
+    cell_t* layout;     // between games so a reset board allocates nothing
+#ifdef _WIN32
+    void* file;         // handles of the mapped file
+    void* mapping;
+#endif
+};
+
+void board_unmap(board_t* board);
+void generate_mines(board_t* board, int safex, int safey);
+bool generate_noguess(board_t* board, int safex, int safey);
+void free_noguess(board_t* board);
+void init_cell_details(board_t* board);
+void generate_touching_details(board_t* board);
+void clear_zeros(board_t* board, int x, int y);
+void push_coord(coord_t** list, size_t* num, size_t* cap, coord_t c);
+
+cell_t* board_cell(board_t* board, int x, int y);
+bool chunk_mine(const board_t* board, int x, int y);
+chunkentry_t* chunk_find(chunkstore_t* store, int cx, int cy, bool insert);
+void chunk_forget(chunkstore_t* store, chunkentry_t* entry);
+chunk_t* chunk_get(board_t* board, int cx, int cy, bool create);
+void chunk_fill(board_t* board, chunk_t* chunk);
+void chunk_evict(board_t* board, chunk_t* chunk);
+
+#endif
@@ -0,0 +1,239 @@
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <pthread.h>
+#include "board_impl.h"
+#include "solver.h"
+#include "rng.h"
+
+/*============================================================================*/
+
+#define MAX_ATTEMPTS (100000)   // candidate layouts tried before giving up
+#define MAX_REPAIRS (64)        // local repairs of one candidate before the next
+#define MAX_THREADS (64)
+
+/* Shared by the threads searching for a board. Candidates are numbered and
+ * the lowest accepted one wins, so the board only depends on the seed and
+ * the first click, never on the thread count or timing. */
+typedef struct {
+    const board_t* board;
+    int safex, safey;
+    long next;          // next candidate to claim
+    long best;          // lowest accepted candidate so far, LONG_MAX if none
+    cell_t* layout;     // mine bits of the best candidate
+    pthread_mutex_t lock;
+} search_t;
+
+/*============================================================================*/
+static board_t* new_scratch(const board_t* board, solver_t** solver);
+static void* search_thread(void* arg);
+static void search(search_t* s, board_t* scratch, solver_t* solver);
+static bool solve(board_t* scratch, solver_t* solver, int safex, int safey);
+static bool touches_revealed(board_t* scratch, int x, int y);
+static bool repair(board_t* scratch, solver_t* solver, rng_t* rng);
+/*================================================*/
+
+bool
+generate_noguess(board_t* board, int safex, int safey) {
+    /* Places mines so that the solver can finish the board from the first
+     * click without guessing. Returns false, leaving a plain layout, when
+     * no such board turned up within MAX_ATTEMPTS candidates. The calling
+     * thread's scratch is kept on the board for the next game. */
+    pthread_t threads[MAX_THREADS];
+    int numthreads = MAX(1, MIN(board->params.threads, MAX_THREADS));
+    size_t n = (size_t)board->width * board->height;
+
+    if (!board->scratch) {
+        board->scratch = new_scratch(board, &board->solver);
+        board->layout = malloc(n);
+        if (!board->layout) {
+            printf("Error allocating a %dx%d no-guess layout\n", board->width, board->height);
+            exit(EXIT_FAILURE);
+        }
+    }
+    search_t s = {board, safex, safey, 0, LONG_MAX, board->layout, PTHREAD_MUTEX_INITIALIZER};
+    for (int i=1; i<numthreads; i++) {
+        if (pthread_create(&threads[i], NULL, search_thread, &s)) {
+            numthreads = i;
+            break;
+        }
+    }
+    search(&s, board->scratch, board->solver);
+    for (int i=1; i<numthreads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    bool found = s.best != LONG_MAX;
+    if (found) {
+        for (size_t i=0; i<n; i++) {
+            board->cells[i] = (board->cells[i] & ~CELL_MINE) | s.layout[i];
+        }
+        board->generated = true;
+    } else {
+        generate_mines(board, safex, safey);
+    }
+    generate_touching_details(board);
+    pthread_mutex_destroy(&s.lock);
+    return found;
+}
+
+void
+free_noguess(board_t* board) {
+    solver_free(board->solver);
+    board_free(board->scratch);
+    free(board->layout);
+}
+
+/*============================================================================*/
+
+static board_t*
+new_scratch(const board_t* board, solver_t** solver) {
+    /* A plain board of the same size with its own solver */
+    board_params_t params = board->params;
+    params.noguess = false;
+    board_t* scratch = board_new(&params);
+    *solver = scratch ? solver_new(scratch) : NULL;
+    if (!*solver) {
+        printf("Error allocating a no-guess search board\n");
+        exit(EXIT_FAILURE);
+    }
+    return scratch;
+}
+
+static void*
+search_thread(void* arg) {
+    /* Helper threads search on scratch of their own for this call */
+    solver_t* solver;
+    board_t* scratch = new_scratch(((search_t*)arg)->board, &solver);
+    search(arg, scratch, solver);
+    solver_free(solver);
+    board_free(scratch);
+    return NULL;
+}
+
+static void
+search(search_t* s, board_t* scratch, solver_t* solver) {
+    /* Claims candidates in order until one is accepted, by this thread or
+     * by another with a lower number */
+    for (;;) {
+        long k = __atomic_fetch_add(&s->next, 1, __ATOMIC_RELAXED);
+        if (k >= MAX_ATTEMPTS || k >= __atomic_load_n(&s->best, __ATOMIC_RELAXED)) {
+            break;
+        }
+        /* Candidate 0 is the plain board for this seed */
+        uint64_t seed = s->board->params.seed ^ ((uint64_t)k * 0xD1B54A32D192ED03ull);
+        rng_t rng;
+        rng_seed(&rng, ~seed);
+        board_reset(scratch, seed);
+        generate_mines(scratch, s->safex, s->safey);
+        generate_touching_details(scratch);
+
+        bool solved = solve(scratch, solver, s->safex, s->safey);
+        for (int r=0; !solved && r<MAX_REPAIRS; r++) {
+            /* Give up on this one once a lower candidate has won */
+            if (k > __atomic_load_n(&s->best, __ATOMIC_RELAXED) || !repair(scratch, solver, &rng)) {
+                break;
+            }
+            solved = solve(scratch, solver, s->safex, s->safey);
+        }
+        if (solved) {
+            pthread_mutex_lock(&s->lock);
+            if (k < s->best) {
+                size_t n = (size_t)scratch->width * scratch->height;
+                for (size_t i=0; i<n; i++) {
+                    s->layout[i] = scratch->cells[i] & CELL_MINE;
+                }
+                __atomic_store_n(&s->best, k, __ATOMIC_RELAXED);
+            }
+            pthread_mutex_unlock(&s->lock);
+            break;
+        }
+    }
+}
+
+static bool
+solve(board_t* scratch, solver_t* solver, int safex, int safey) {
+    /* Plays the layout from the first click, revealing only what the
+     * solver proves safe. Accepted if that wins the game. */
+    size_t n = (size_t)scratch->width * scratch->height;
+    const coord_t* changed;
+    size_t num;
+    coord_t c;
+
+    for (size_t i=0; i<n; i++) {
+        scratch->cells[i] &= CELL_MINE | CELL_COUNT;
+    }
+    scratch->numrevealed = 0;
+    scratch->status = BOARD_PLAYING;
+    scratch->generated = true;
+    solver_reset(solver);
+
+    board_reveal(scratch, safex, safey);
+    changed = board_changes(scratch, &num);
+    solver_update(solver, changed, num);
+    while (scratch->status == BOARD_PLAYING && solver_next_safe(solver, &c)) {
+        board_reveal(scratch, c.x, c.y);
+        changed = board_changes(scratch, &num);
+        solver_update(solver, changed, num);
+    }
+    return scratch->status == BOARD_WON;
+}
+
+static bool
+touches_revealed(board_t* scratch, int x, int y) {
+    for (int dy=-1; dy<=1; dy++) {
+        for (int dx=-1; dx<=1; dx++) {
+            cell_t* nb = board_cell(scratch, x+dx, y+dy);
+            if (nb && (*nb & CELL_REVEALED)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static bool
+repair(board_t* scratch, solver_t* solver, rng_t* rng) {
+    /* The solver is stuck. Picks an undecided hidden cell on the edge of
+     * the opened area and swaps its mine bit with a hidden cell away from
+     * it, keeping the mine count. Only the numbers around the edge cell
+     * change, so the next attempt usually opens the same area and gets
+     * further. Returns false if there is no such pair. */
+    int w = scratch->width;
+    int h = scratch->height;
+    size_t n = (size_t)w * h;
+    size_t edge = n, far = n;
+    size_t seen = 0;
+
+    /* Reservoir sample an edge cell, then a far cell of the other kind */
+    for (int y=0; y<h; y++) {
+        for (int x=0; x<w; x++) {
+            size_t i = (size_t)y*w + x;
+            if (!(scratch->cells[i] & CELL_REVEALED) && solver_known(solver, x, y) == SOLVER_UNKNOWN
+                    && touches_revealed(scratch, x, y) && rng_below(rng, ++seen) == 0) {
+                edge = i;
+            }
+        }
+    }
+    if (edge == n) {
+        return false;
+    }
+    cell_t want = (scratch->cells[edge] & CELL_MINE) ^ CELL_MINE;
+    seen = 0;
+    for (int y=0; y<h; y++) {
+        for (int x=0; x<w; x++) {
+            size_t i = (size_t)y*w + x;
+            if (!(scratch->cells[i] & CELL_REVEALED) && (scratch->cells[i] & CELL_MINE) == want
+                    && !touches_revealed(scratch, x, y) && rng_below(rng, ++seen) == 0) {
+                far = i;
+            }
+        }
+    }
+    if (far == n) {
+        return false;
+    }
+    scratch->cells[edge] ^= CELL_MINE;
+    scratch->cells[far] ^= CELL_MINE;
+    generate_touching_details(scratch);
+    return true;
+}
@@ -0,0 +1,738 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "board_impl.h"
+#include "prob.h"
+
+/*============================================================================*/
+
+#define MAX_THREADS (64)
+#define ENUM_BUDGET (1 << 20)   // backtracking steps per component before estimating it
+
+/* A revealed number and the hidden cells around it */
+typedef struct {
+    int pos;            // linear index of the number
+    int mines;          // mines among its hidden neighbours
+    int numcells;
+    int cells[8];       // frontier ids of its hidden neighbours
+} constraint_t;
+
+/* Cells of a component that touch exactly the same numbers. They are
+ * interchangeable, so only how many of them are mines is enumerated. */
+typedef struct {
+    int numcons;
+    int cons[8];        // component-local constraint ids, ascending
+    int size;
+} class_t;
+
+/* Layout counts of one component, kept while the component is unchanged */
+typedef struct {
+    uint64_t hash;
+    int* sig;           // the component's numbers and cells, compared on hit
+    size_t siglen;
+    int numclasses;
+    int maxmines;       // the component's cell count
+    double* count;      // [maxmines+1] layouts with k mines, scaled
+    double* expect;     // [numclasses][maxmines+1] mines summed over those layouts
+    bool approx;        // too big to enumerate, estimated from the density
+    bool used;          // seen by the current prob_compute
+} result_t;
+
+/* One component to enumerate */
+typedef struct {
+    int numcells;
+    int* pos;           // linear index of each cell
+    int* cellclass;
+    int numcons;
+    int* need;          // per constraint: mines still to place
+    int* room;          // per constraint: cells not yet assigned
+    int numclasses;
+    class_t* classes;
+    int* assign;        // mines placed in each class so far
+    long steps;         // backtracking steps taken, stops at ENUM_BUDGET
+    result_t* result;
+} job_t;
+
+struct prob {
+    board_t* board;
+    int numthreads;
+    float* p;           // per cell probability, -1 when revealed
+    int* frontier;      // per cell frontier id, -1 for other cells
+    constraint_t* cons;
+    size_t numcons, capcons;
+    int* front;         // linear index of each frontier cell
+    size_t numfront, capfront;
+    int* parent;        // union-find over frontier ids
+    size_t capparent;
+    result_t** cache;
+    size_t numcache, capcache;
+    job_t* jobs;        // current components
+    int numjobs;
+    int* pending;       // jobs missing from the cache
+    int numpending;
+    int nextpending;    // claimed atomically by the enumeration threads
+    bool exact;         // no component of the last prob_compute was estimated
+};
+
+static const double binom[9][9] = {
+    {1},
+    {1, 1},
+    {1, 2, 1},
+    {1, 3, 3, 1},
+    {1, 4, 6, 4, 1},
+    {1, 5, 10, 10, 5, 1},
+    {1, 6, 15, 20, 15, 6, 1},
+    {1, 7, 21, 35, 35, 21, 7, 1},
+    {1, 8, 28, 56, 70, 56, 28, 8, 1},
+};
+
+/*============================================================================*/
+static void* grow(void* list, size_t* cap, size_t need, size_t size);
+static void* scratch(size_t size);
+static int find_root(int* parent, int i);
+static bool gather(prob_t* prob);
+static void build_job(prob_t* prob, job_t* job, int* compcons, int numcompcons);
+static result_t* lookup(prob_t* prob, job_t* job);
+static void enumerate(job_t* job, int c, int mines, double weight);
+static void solve_job(job_t* job);
+static void estimate(job_t* job);
+static void* run_jobs(void* arg);
+static double log_choose(double n, double k);
+static bool combine(prob_t* prob);
+static void free_result(result_t* result);
+static void free_jobs(prob_t* prob);
+/*================================================*/
+
+prob_t*
+prob_new(board_t* board, int numthreads) {
+    if (board->params.infinite) {
+        return NULL;
+    }
+    size_t n = (size_t)board->width * board->height;
+    prob_t* prob = calloc(1, sizeof(prob_t));
+    if (!prob) {
+        return NULL;
+    }
+    prob->board = board;
+    prob->numthreads = MAX(1, MIN(numthreads, MAX_THREADS));
+    prob->p = malloc(n * sizeof(float));
+    prob->frontier = malloc(n * sizeof(int));
+    if (!prob->p || !prob->frontier) {
+        prob_free(prob);
+        return NULL;
+    }
+    for (size_t i=0; i<n; i++) {
+        prob->p[i] = -1.0f;
+        prob->frontier[i] = -1;
+    }
+    return prob;
+}
+
+void
+prob_free(prob_t* prob) {
+    if (!prob) {
+        return;
+    }
+    free_jobs(prob);
+    for (size_t i=0; i<prob->numcache; i++) {
+        free_result(prob->cache[i]);
+    }
+    free(prob->cache);
+    free(prob->p);
+    free(prob->frontier);
+    free(prob->cons);
+    free(prob->front);
+    free(prob->parent);
+    free(prob);
+}
+
+bool
+prob_compute(prob_t* prob) {
+    bool ok = false;
+
+    if (gather(prob)) {
+        /* Enumerate the components nobody has seen before, spreading them
+         * over threads when there are several */
+        pthread_t threads[MAX_THREADS];
+        int numthreads = MIN(prob->numthreads, prob->numpending) - 1;
+        prob->nextpending = 0;
+        for (int i=0; i<numthreads; i++) {
+            if (pthread_create(&threads[i], NULL, run_jobs, prob)) {
+                numthreads = i;
+                break;
+            }
+        }
+        run_jobs(prob);
+        for (int i=0; i<numthreads; i++) {
+            pthread_join(threads[i], NULL);
+        }
+        ok = combine(prob);
+        prob->exact = true;
+        for (int i=0; i<prob->numjobs; i++) {
+            prob->exact = prob->exact && !prob->jobs[i].result->approx;
+        }
+    }
+    if (!ok) {
+        size_t n = (size_t)prob->board->width * prob->board->height;
+        for (size_t i=0; i<n; i++) {
+            prob->p[i] = -1.0f;
+        }
+    }
+
+    /* Drop cached components that no longer exist */
+    size_t kept = 0;
+    for (size_t i=0; i<prob->numcache; i++) {
+        if (prob->cache[i]->used) {
+            prob->cache[i]->used = false;
+            prob->cache[kept++] = prob->cache[i];
+        } else {
+            free_result(prob->cache[i]);
+        }
+    }
+    prob->numcache = kept;
+    free_jobs(prob);
+    return ok;
+}
+
+double
+prob_mine(const prob_t* prob, int x, int y) {
+    if (x<0 || x>=prob->board->width || y<0 || y>=prob->board->height) {
+        return -1.0;
+    }
+    return prob->p[(size_t)y*prob->board->width + x];
+}
+
+bool
+prob_exact(const prob_t* prob) {
+    return prob->exact;
+}
+
+bool
+prob_best(const prob_t* prob, coord_t* cell) {
+    size_t n = (size_t)prob->board->width * prob->board->height;
+    size_t best = n;
+    for (size_t i=0; i<n; i++) {
+        if (prob->p[i] >= 0.0f && (best == n || prob->p[i] < prob->p[best])) {
+            best = i;
+        }
+    }
+    if (best == n) {
+        return false;
+    }
+    cell->x = (int)(best % prob->board->width);
+    cell->y = (int)(best / prob->board->width);
+    return true;
+}
+
+/*============================================================================*/
+
+static void*
+grow(void* list, size_t* cap, size_t need, size_t size) {
+    /* Grows list geometrically to hold at least need entries */
+    if (need <= *cap) {
+        return list;
+    }
+    size_t newcap = MAX(*cap * 2, MAX(need, 256));
+    void* grown = realloc(list, newcap * size);
+    if (!grown) {
+        printf("Error growing probability buffers to %zu entries\n", newcap);
+        exit(EXIT_FAILURE);
+    }
+    *cap = newcap;
+    return grown;
+}
+
+static void*
+scratch(size_t size) {
+    void* p = calloc(1, size ? size : 1);
+    if (!p) {
+        printf("Error allocating %zu bytes of probability scratch\n", size);
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+static int
+find_root(int* parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+static bool
+gather(prob_t* prob) {
+    /* Collects the numbers bordering hidden cells, splits them into
+     * connected components and sets up a job for each */
+    board_t* board = prob->board;
+    int w = board->width;
+    int h = board->height;
+
+    for (size_t i=0; i<prob->numfront; i++) {
+        prob->frontier[prob->front[i]] = -1;
+    }
+    prob->numcons = 0;
+    prob->numfront = 0;
+    for (int y=0; y<h; y++) {
+        for (int x=0; x<w; x++) {
+            size_t i = (size_t)y*w + x;
+            cell_t cell = board->cells[i];
+            prob->p[i] = (cell & CELL_REVEALED) ? -1.0f : 0.0f;
+            if (!(cell & CELL_REVEALED)) {
+                continue;
+            }
+            if (cell & CELL_MINE) {
+                return false;
+            }
+            constraint_t con = {(int)i, cell & CELL_COUNT, 0, {0}};
+            for (int dy=-1; dy<=1; dy++) {
+                for (int dx=-1; dx<=1; dx++) {
+                    int nx = x + dx;
+                    int ny = y + dy;
+                    if ((!dx && !dy) || nx<0 || nx>=w || ny<0 || ny>=h) {
+                        continue;
+                    }
+                    size_t n = (size_t)ny*w + nx;
+                    if (board->cells[n] & CELL_REVEALED) {
+                        continue;
+                    }
+                    if (prob->frontier[n] < 0) {
+                        prob->front = grow(prob->front, &prob->capfront, prob->numfront + 1, sizeof(int));
+                        prob->frontier[n] = (int)prob->numfront;
+                        prob->front[prob->numfront++] = (int)n;
+                    }
+                    con.cells[con.numcells++] = prob->frontier[n];
+                }
+            }
+            if (con.numcells > 0) {
+                prob->cons = grow(prob->cons, &prob->capcons, prob->numcons + 1, sizeof(constraint_t));
+                prob->cons[prob->numcons++] = con;
+            } else if (con.mines > 0) {
+                return false;
+            }
+        }
+    }
+
+    /* Numbers sharing a hidden cell belong to the same component */
+    prob->parent = grow(prob->parent, &prob->capparent, prob->numfront, sizeof(int));
+    for (size_t i=0; i<prob->numfront; i++) {
+        prob->parent[i] = (int)i;
+    }
+    for (size_t i=0; i<prob->numcons; i++) {
+        constraint_t* con = &prob->cons[i];
+        int a = find_root(prob->parent, con->cells[0]);
+        for (int j=1; j<con->numcells; j++) {
+            int b = find_root(prob->parent, con->cells[j]);
+            prob->parent[b] = a;
+        }
+    }
+
+    /* Bucket the constraints by component root, keeping scan order */
+    int* first = scratch(prob->numfront * sizeof(int));
+    int* count = scratch(prob->numfront * sizeof(int));
+    int* order = scratch(prob->numcons * sizeof(int));
+    int* roots = scratch(prob->numfront * sizeof(int));
+    int numroots = 0;
+    for (size_t i=0; i<prob->numcons; i++) {
+        int r = find_root(prob->parent, prob->cons[i].cells[0]);
+        if (count[r]++ == 0) {
+            roots[numroots++] = r;
+        }
+    }
+    int at = 0;
+    for (int i=0; i<numroots; i++) {
+        first[roots[i]] = at;
+        at += count[roots[i]];
+        count[roots[i]] = 0;
+    }
+    for (size_t i=0; i<prob->numcons; i++) {
+        int r = find_root(prob->parent, prob->cons[i].cells[0]);
+        order[first[r] + count[r]++] = (int)i;
+    }
+
+    prob->jobs = scratch(numroots * sizeof(job_t));
+    prob->pending = scratch(numroots * sizeof(int));
+    prob->numjobs = numroots;
+    prob->numpending = 0;
+    for (int i=0; i<numroots; i++) {
+        job_t* job = &prob->jobs[i];
+        build_job(prob, job, &order[first[roots[i]]], count[roots[i]]);
+        job->result = lookup(prob, job);
+        if (job->result->count == NULL) {
+            prob->pending[prob->numpending++] = i;
+        }
+    }
+    free(first);
+    free(count);
+    free(order);
+    free(roots);
+    return true;
+}
+
+static void
+build_job(prob_t* prob, job_t* job, int* compcons, int numcompcons) {
+    /* Gives the component local cell ids and groups its cells into classes */
+    job->numcons = numcompcons;
+    job->need = scratch(numcompcons * sizeof(int));
+    job->room = scratch(numcompcons * sizeof(int));
+    job->pos = scratch(numcompcons * 8 * sizeof(int));
+    class_t* cellcons = scratch(numcompcons * 8 * sizeof(class_t));
+    job->numcells = 0;
+    for (int c=0; c<numcompcons; c++) {
+        constraint_t* con = &prob->cons[compcons[c]];
+        job->need[c] = con->mines;
+        job->room[c] = con->numcells;
+        for (int j=0; j<con->numcells; j++) {
+            int n = prob->front[con->cells[j]];
+            /* Frontier ids are reused as local ids while building */
+            int local = -1;
+            if (prob->frontier[n] >= 0) {
+                local = job->numcells++;
+                job->pos[local] = n;
+                prob->frontier[n] = -2 - local;
+            } else {
+                local = -2 - prob->frontier[n];
+            }
+            class_t* cc = &cellcons[local];
+            cc->cons[cc->numcons++] = c;
+        }
+    }
+    /* Clear the frontier ids */
+    for (int i=0; i<job->numcells; i++) {
+        prob->frontier[job->pos[i]] = 0;
+    }
+
+    job->cellclass = scratch(job->numcells * sizeof(int));
+    job->classes = scratch(job->numcells * sizeof(class_t));
+    job->assign = scratch(job->numcells * sizeof(int));
+    job->numclasses = 0;
+    for (int i=0; i<job->numcells; i++) {
+        class_t* cc = &cellcons[i];
+        int k;
+        for (k=0; k<job->numclasses; k++) {
+            class_t* cl = &job->classes[k];
+            if (cl->numcons == cc->numcons
+                    && memcmp(cl->cons, cc->cons, cc->numcons * sizeof(int)) == 0) {
+                break;
+            }
+        }
+        if (k == job->numclasses) {
+            job->classes[job->numclasses] = *cc;
+            job->classes[job->numclasses++].size = 0;
+        }
+        job->classes[k].size++;
+        job->cellclass[i] = k;
+    }
+    free(cellcons);
+}
+
+static result_t*
+lookup(prob_t* prob, job_t* job) {
+    /* Finds the component's counts from an earlier call, or adds an empty
+     * entry to be enumerated. The signature is the component's numbers
+     * with their mine counts and cells, which determine the result. */
+    size_t siglen = 1 + (size_t)job->numcons * 2 + job->numcells;
+    int* sig = scratch(siglen * sizeof(int));
+    size_t at = 0;
+    sig[at++] = job->numcons;
+    for (int c=0; c<job->numcons; c++) {
+        sig[at++] = job->need[c];
+        sig[at++] = job->room[c];
+    }
+    for (int i=0; i<job->numcells; i++) {
+        sig[at++] = job->pos[i];
+    }
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i=0; i<siglen; i++) {
+        hash = (hash ^ (uint32_t)sig[i]) * 0x100000001b3ull;
+    }
+
+    for (size_t i=0; i<prob->numcache; i++) {
+        result_t* r = prob->cache[i];
+        if (r->hash == hash && r->siglen == siglen && !r->used
+                && memcmp(r->sig, sig, siglen * sizeof(int)) == 0) {
+            r->used = true;
+            free(sig);
+            return r;
+        }
+    }
+    result_t* r = scratch(sizeof(result_t));
+    r->hash = hash;
+    r->sig = sig;
+    r->siglen = siglen;
+    r->numclasses = job->numclasses;
+    r->maxmines = job->numcells;
+    r->used = true;
+    prob->cache = grow(prob->cache, &prob->capcache, prob->numcache + 1, sizeof(result_t*));
+    prob->cache[prob->numcache++] = r;
+    return r;
+}
+
+static void
+enumerate(job_t* job, int c, int mines, double weight) {
+    /* Places 0..size mines in class c and recurses, pruning as soon as a
+     * number is over its count or can no longer reach it. Gives up once
+     * the component has used its budget. */
+    result_t* r = job->result;
+    if (++job->steps > ENUM_BUDGET) {
+        return;
+    }
+    if (c == job->numclasses) {
+        r->count[mines] += weight;
+        for (int i=0; i<job->numclasses; i++) {
+            r->expect[(size_t)i*(r->maxmines+1) + mines] += weight * job->assign[i];
+        }
+        return;
+    }
+    class_t* cl = &job->classes[c];
+    for (int m=0; m<=cl->size; m++) {
+        bool fits = true;
+        for (int j=0; j<cl->numcons; j++) {
+            int k = cl->cons[j];
+            if (m > job->need[k] || job->need[k] - m > job->room[k] - cl->size) {
+                fits = false;
+            }
+        }
+        if (!fits) {
+            continue;
+        }
+        for (int j=0; j<cl->numcons; j++) {
+            job->need[cl->cons[j]] -= m;
+            job->room[cl->cons[j]] -= cl->size;
+        }
+        job->assign[c] = m;
+        enumerate(job, c+1, mines + m, weight * binom[cl->size][m]);
+        for (int j=0; j<cl->numcons; j++) {
+            job->need[cl->cons[j]] += m;
+            job->room[cl->cons[j]] += cl->size;
+        }
+    }
+}
+
+static void
+solve_job(job_t* job) {
+    result_t* r = job->result;
+    size_t len = (size_t)r->maxmines + 1;
+    double* count = scratch(len * sizeof(double));
+    r->expect = scratch(len * r->numclasses * sizeof(double));
+    r->count = count;
+    job->steps = 0;
+    enumerate(job, 0, 0, 1.0);
+    if (job->steps > ENUM_BUDGET) {
+        estimate(job);
+        return;
+    }
+
+    /* Only ratios matter; scale so products of components stay in range */
+    double top = 0.0;
+    for (size_t k=0; k<len; k++) {
+        top = MAX(top, count[k]);
+    }
+    if (top > 0.0) {
+        for (size_t k=0; k<len; k++) {
+            count[k] /= top;
+        }
+        for (size_t k=0; k<len * r->numclasses; k++) {
+            r->expect[k] /= top;
+        }
+    }
+}
+
+static void
+estimate(job_t* job) {
+    /* Layouts of a component too tangled to enumerate in time are counted
+     * as if its numbers were not there: k mines in C(n,k) ways, spread
+     * evenly. Its cells then get about the interior probability, which is
+     * a guess but keeps prob_compute's time bounded on any board. */
+    result_t* r = job->result;
+    int n = r->maxmines;
+    double mid = log_choose(n, n / 2);
+    for (int k=0; k<=n; k++) {
+        r->count[k] = exp(log_choose(n, k) - mid);
+        for (int c=0; c<r->numclasses; c++) {
+            r->expect[(size_t)c*(n+1) + k] = r->count[k] * k * job->classes[c].size / n;
+        }
+    }
+    r->approx = true;
+}
+
+static void*
+run_jobs(void* arg) {
+    prob_t* prob = arg;
+    for (;;) {
+        int i = __atomic_fetch_add(&prob->nextpending, 1, __ATOMIC_RELAXED);
+        if (i >= prob->numpending) {
+            return NULL;
+        }
+        solve_job(&prob->jobs[prob->pending[i]]);
+    }
+}
+
+static double
+log_choose(double n, double k) {
+    return lgamma(n + 1) - lgamma(k + 1) - lgamma(n - k + 1);
+}
+
+static bool
+combine(prob_t* prob) {
+    /* Weighs every total of frontier mines t by the C(L,R-t) ways to place
+     * the other R-t mines in the L interior cells. Component counts are
+     * tilted by x^k, x the odds of a mine at the board's density, and
+     * scaled to sum to 1; the weights are tilted by x^-t to match, which
+     * cancels out but keeps every product near 1 however many components
+     * there are. prefix[i] convolves the components before i and rest[i][u]
+     * is the weight of every completion by components i on, given u mines
+     * so far, so each component costs O(M * its cells). */
+    board_t* board = prob->board;
+    size_t n = (size_t)board->width * board->height;
+    int numjobs = prob->numjobs;
+    long hidden = 0;
+    for (size_t i=0; i<n; i++) {
+        hidden += prob->p[i] >= 0.0f;
+    }
+    long interior = hidden - (long)prob->numfront;
+    int total = board->params.nummines;
+    int top = (int)MIN((long)total, (long)prob->numfront);
+    size_t len = (size_t)top + 1;
+    double q = hidden > 0 ? (double)total / hidden : 0.5;
+    q = MIN(MAX(q, 1e-9), 1.0 - 1e-9);
+    double logx = log(q / (1.0 - q));
+
+    double** tilted = scratch(MAX(numjobs, 1) * sizeof(double*));
+    for (int i=0; i<numjobs; i++) {
+        result_t* r = prob->jobs[i].result;
+        double* t = tilted[i] = scratch(((size_t)r->maxmines + 1) * sizeof(double));
+        double peak = -INFINITY, sum = 0.0;
+        for (int k=0; k<=r->maxmines; k++) {
+            if (r->count[k] > 0.0) {
+                peak = MAX(peak, log(r->count[k]) + k * logx);
+            }
+        }
+        for (int k=0; k<=r->maxmines; k++) {
+            t[k] = r->count[k] > 0.0 ? exp(log(r->count[k]) + k * logx - peak) : 0.0;
+            sum += t[k];
+        }
+        for (int k=0; sum > 0.0 && k<=r->maxmines; k++) {
+            t[k] /= sum;
+        }
+    }
+
+    double* weight = scratch(len * sizeof(double));
+    double best = -INFINITY;
+    for (int t=0; t<=top; t++) {
+        if (total - t <= interior) {
+            best = MAX(best, log_choose((double)interior, (double)(total - t)) - t * logx);
+        }
+    }
+    for (int t=0; t<=top; t++) {
+        if (total - t <= interior) {
+            weight[t] = exp(log_choose((double)interior, (double)(total - t)) - t * logx - best);
+        }
+    }
+
+    double* prefix = scratch((numjobs + 1) * len * sizeof(double));
+    double* rest = scratch((numjobs + 1) * len * sizeof(double));
+    prefix[0] = 1.0;
+    for (int i=0; i<numjobs; i++) {
+        int m = prob->jobs[i].result->maxmines;
+        double* in = &prefix[(size_t)i * len];
+        double* out = &prefix[(size_t)(i+1) * len];
+        for (int s=0; s<=top; s++) {
+            for (int k=0; in[s] != 0.0 && k<=m && s+k<=top; k++) {
+                out[s+k] += in[s] * tilted[i][k];
+            }
+        }
+    }
+    memcpy(&rest[(size_t)numjobs * len], weight, len * sizeof(double));
+    for (int i=numjobs-1; i>=0; i--) {
+        int m = prob->jobs[i].result->maxmines;
+        double* in = &rest[(size_t)(i+1) * len];
+        double* out = &rest[(size_t)i * len];
+        for (int u=0; u<=top; u++) {
+            for (int k=0; k<=m && u+k<=top; k++) {
+                out[u] += tilted[i][k] * in[u+k];
+            }
+        }
+    }
+
+    double z = rest[0], interiormines = 0.0;
+    double* all = &prefix[(size_t)numjobs * len];
+    for (int t=0; t<=top; t++) {
+        interiormines += all[t] * weight[t] * (total - t);
+    }
+    bool ok = z > 0.0;
+
+    double* factor = scratch(len * sizeof(double));
+    for (int i=0; ok && i<numjobs; i++) {
+        job_t* job = &prob->jobs[i];
+        result_t* r = job->result;
+        double* before = &prefix[(size_t)i * len];
+        double* after = &rest[(size_t)(i+1) * len];
+        /* factor[k]: weight of every completion given k mines here */
+        for (int k=0; k<=r->maxmines && k<=top; k++) {
+            factor[k] = 0.0;
+            for (int a=0; a+k<=top; a++) {
+                factor[k] += before[a] * after[a+k];
+            }
+        }
+        for (int c=0; c<job->numcells; c++) {
+            int cl = job->cellclass[c];
+            const double* e = &r->expect[(size_t)cl * (r->maxmines+1)];
+            double sum = 0.0;
+            for (int k=0; k<=r->maxmines && k<=top; k++) {
+                if (r->count[k] > 0.0) {
+                    sum += e[k] / r->count[k] * tilted[i][k] * factor[k];
+                }
+            }
+            prob->p[job->pos[c]] = (float)(sum / (z * job->classes[cl].size));
+        }
+    }
+
+    /* Every interior cell is equally likely */
+    if (ok && interior > 0) {
+        float p = (float)(interiormines / (z * interior));
+        for (size_t i=0; i<n; i++) {
+            if (prob->p[i] >= 0.0f && prob->frontier[i] < 0) {
+                prob->p[i] = p;
+            }
+        }
+    }
+    for (int i=0; i<numjobs; i++) {
+        free(tilted[i]);
+    }
+    free(tilted);
+    free(weight);
+    free(prefix);
+    free(rest);
+    free(factor);
+    return ok;
+}
+
+static void
+free_result(result_t* result) {
+    free(result->sig);
+    free(result->count);
+    free(result->expect);
+    free(result);
+}
+
+static void
+free_jobs(prob_t* prob) {
+    for (int i=0; i<prob->numjobs; i++) {
+        job_t* job = &prob->jobs[i];
+        free(job->pos);
+        free(job->cellclass);
+        free(job->need);
+        free(job->room);
+        free(job->classes);
+        free(job->assign);
+    }
+    free(prob->jobs);
+    free(prob->pending);
+    prob->jobs = NULL;
+    prob->pending = NULL;
+    prob->numjobs = 0;
+    prob->numpending = 0;
+}
@@ -0,0 +1,35 @@
+#ifndef PROB_H
+#define PROB_H
+
+/* Exact mine probabilities for every hidden cell. The frontier (hidden
+ * cells next to revealed numbers) is split into independent components,
+ * each enumerated by backtracking over groups of interchangeable cells.
+ * The components are then combined with binomial weights for the interior
+ * cells under the board's mine count. Components unchanged since the last
+ * call are reused, and new ones are enumerated on several threads. A
+ * component that needs more than a fixed number of backtracking steps is
+ * estimated from the mine density instead, so one call stays well under
+ * a second on any board. Fixed-size boards only. */
+
+#include "board.h"
+
+typedef struct prob prob_t;
+
+/* Returns NULL for infinite boards or when memory runs out */
+prob_t* prob_new(board_t* board, int numthreads);
+void prob_free(prob_t* prob);
+
+/* Recomputes every probability from the board. Returns false when the
+ * revealed numbers admit no mine layout, e.g. after a mine was hit. */
+bool prob_compute(prob_t* prob);
+
+/* False if the last prob_compute estimated some components */
+bool prob_exact(const prob_t* prob);
+
+/* Chance that (x,y) is a mine as of the last prob_compute, or -1 for
+ * revealed cells */
+double prob_mine(const prob_t* prob, int x, int y);
+/* The hidden cell least likely to be a mine; false if none is left */
+bool prob_best(const prob_t* prob, coord_t* cell);
+
+#endif
@@ -0,0 +1,664 @@
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "board_impl.h"
+#include "replay.h"
+
+/*============================================================================*/
+
+#define WRITE_BUFFER (1 << 16)
+#define KIND_BLOCK (3)
+#define BLOCK_MINES (0)
+#define BLOCK_KEYFRAME (1)
+#define FLAG_INFINITE (1)
+#define FLAG_NOGUESS (2)
+
+struct replay_writer {
+    FILE* file;
+    bool failed;
+    bool infinite;
+    int interval;
+    size_t moves;
+    int lastx, lasty;
+    uint32_t lastms;
+    bool mineswritten;
+    uint8_t* state;     // fixed boards: revealed/flag bits, 2 per cell, kept
+    size_t statesize;   // up to date from each move's changes
+    size_t used;
+    uint8_t buf[WRITE_BUFFER];
+};
+
+typedef struct {
+    size_t move;        // moves applied before it was taken
+    size_t offset;      // of the keyframe block body, after its kind
+} keyframe_t;
+
+/* Read position in the mapped file */
+typedef struct {
+    const uint8_t* p;
+    const uint8_t* end;
+    bool bad;           // ran off the end or read nonsense
+    bool cut;           // ran off the end
+} cursor_t;
+
+struct replay {
+    const uint8_t* data;
+    size_t size;        // up to the last whole record
+    size_t mapsize;
+#ifdef _WIN32
+    HANDLE file, mapping;
+#endif
+    board_params_t params;
+    int interval;
+    size_t records;     // offset of the first record
+    size_t length;      // moves in the replay
+    size_t mines;       // offset of the mine bitmap, 0 if none
+    size_t start;       // offset of the move 0 keyframe body, 0 if none
+    keyframe_t* keys;   // keyframe i is taken after move (i+1)*interval
+    size_t numkeys, capkeys;
+    /* Playback position */
+    size_t at;          // offset of the next record
+    size_t move;        // moves applied so far
+    int lastx, lasty;
+    uint32_t lastms;
+    size_t lastkey;     // keyframe taken after the last move, numkeys if none
+};
+
+/*============================================================================*/
+static void put_bytes(replay_writer_t* w, const void* data, size_t n);
+static void put_varint(replay_writer_t* w, uint64_t v);
+static void put_mines(replay_writer_t* w, const board_t* board);
+static void put_keyframe(replay_writer_t* w, bool generated);
+static void track(replay_writer_t* w, const board_t* board, int x, int y);
+static uint64_t get_varint(cursor_t* c);
+static const uint8_t* get_bytes(cursor_t* c, size_t n);
+static uint64_t zigzag(int64_t v);
+static int64_t unzigzag(uint64_t v);
+static size_t bitmap_size(const board_params_t* params, int bits);
+static bool map_file(replay_t* replay, const char* path);
+static void unmap_file(replay_t* replay);
+static bool scan(replay_t* replay);
+static bool read_block(replay_t* replay, cursor_t* c, bool index);
+static bool restore(replay_t* replay, board_t* board, const keyframe_t* key);
+/*================================================*/
+
+replay_writer_t*
+replay_create(const char* path, const board_t* board, int interval) {
+    const board_params_t* params = &board->params;
+    replay_writer_t* w = calloc(1, sizeof(replay_writer_t));
+    if (!w) {
+        return NULL;
+    }
+    if (!params->infinite) {
+        w->statesize = bitmap_size(params, 2);
+        w->state = calloc(w->statesize, 1);
+    }
+    w->file = (w->state || params->infinite) ? fopen(path, "wb") : NULL;
+    if (!w->file) {
+        free(w->state);
+        free(w);
+        return NULL;
+    }
+    w->infinite = params->infinite;
+    w->interval = interval > 0 ? interval : REPLAY_INTERVAL;
+    put_bytes(w, "MSRP", 4);
+    uint8_t head[2] = {REPLAY_VERSION, (params->infinite ? FLAG_INFINITE : 0) | (params->noguess ? FLAG_NOGUESS : 0)};
+    put_bytes(w, head, 2);
+    put_varint(w, params->width);
+    put_varint(w, params->height);
+    put_varint(w, params->nummines);
+    put_varint(w, params->density);
+    put_varint(w, params->seed);
+    put_varint(w, w->interval);
+    if (params->infinite) {
+        return w;
+    }
+
+    /* A board that was loaded mid-game starts the recording as it is */
+    size_t n = (size_t)board->width * board->height;
+    bool started = board->generated;
+    for (size_t i=0; i<n; i++) {
+        started = started || (board->cells[i] & (CELL_REVEALED | CELL_FLAG));
+    }
+    if (started) {
+        for (size_t i=0; i<n; i++) {
+            track(w, board, (int)(i % board->width), (int)(i / board->width));
+        }
+        if (board->generated) {
+            put_mines(w, board);
+        }
+        put_keyframe(w, board->generated);
+    }
+    return w;
+}
+
+void
+replay_record(replay_writer_t* w, const board_t* board, replay_action_t action,
+              int x, int y, uint32_t ms) {
+    uint32_t dt = ms >= w->lastms ? ms - w->lastms : 0;
+    put_varint(w, ((uint64_t)dt << 2) | action);
+    put_varint(w, zigzag((int64_t)x - w->lastx));
+    put_varint(w, zigzag((int64_t)y - w->lasty));
+    w->lastx = x;
+    w->lasty = y;
+    w->lastms += dt;
+    w->moves++;
+    if (w->infinite) {
+        return;     // infinite boards are rebuilt from the seed, no snapshots
+    }
+
+    /* Only the cells this move changed are looked at, so a keyframe costs
+     * one copy of the kept bits however big the board is */
+    size_t num;
+    const coord_t* changed = board_changes(board, &num);
+    for (size_t i=0; i<num; i++) {
+        track(w, board, changed[i].x, changed[i].y);
+    }
+    if (board->generated && !w->mineswritten) {
+        put_mines(w, board);
+    }
+    if (w->moves % w->interval == 0) {
+        put_keyframe(w, board->generated);
+    }
+}
+
+bool
+replay_finish(replay_writer_t* w) {
+    if (w->used > 0 && fwrite(w->buf, 1, w->used, w->file) != w->used) {
+        w->failed = true;
+    }
+    if (fclose(w->file)) {
+        w->failed = true;
+    }
+    bool ok = !w->failed;
+    free(w->state);
+    free(w);
+    return ok;
+}
+
+replay_t*
+replay_open(const char* path) {
+    replay_t* replay = calloc(1, sizeof(replay_t));
+    if (!replay) {
+        return NULL;
+    }
+    if (!map_file(replay, path)) {
+        free(replay);
+        return NULL;
+    }
+    if (!scan(replay)) {
+        replay_close(replay);
+        return NULL;
+    }
+    replay->at = replay->records;
+    replay->lastkey = replay->numkeys;
+    return replay;
+}
+
+void
+replay_close(replay_t* replay) {
+    if (!replay) {
+        return;
+    }
+    unmap_file(replay);
+    free(replay->keys);
+    free(replay);
+}
+
+const board_params_t*
+replay_params(const replay_t* replay) {
+    return &replay->params;
+}
+
+size_t
+replay_length(const replay_t* replay) {
+    return replay->length;
+}
+
+bool
+replay_seek(replay_t* replay, board_t* board, size_t move) {
+    /* Start from the last keyframe at or before move, then step forwards */
+    size_t lo = 0, hi = replay->numkeys;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (replay->keys[mid].move <= move) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    replay->lastkey = replay->numkeys;
+    if (lo > 0) {
+        if (!restore(replay, board, &replay->keys[lo-1])) {
+            return false;
+        }
+        replay->lastkey = lo - 1;
+    } else if (replay->start) {
+        keyframe_t start = {0, replay->start};
+        if (!restore(replay, board, &start)) {
+            return false;
+        }
+    } else {
+        board_reset(board, replay->params.seed);
+        replay->at = replay->records;
+        replay->move = 0;
+        replay->lastx = replay->lasty = 0;
+        replay->lastms = 0;
+    }
+    replay_event_t event;
+    while (replay->move < move) {
+        if (!replay_step(replay, board, &event)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool
+replay_step(replay_t* replay, board_t* board, replay_event_t* event) {
+    cursor_t c = {replay->data + replay->at, replay->data + replay->size, false, false};
+    if (c.p == c.end) {
+        return false;
+    }
+    uint64_t head = get_varint(&c);
+    uint64_t dx = get_varint(&c);
+    uint64_t dy = get_varint(&c);
+    /* scan already checked that records start with a move here */
+    event->action = (replay_action_t)(head & 3);
+    event->ms = replay->lastms + (uint32_t)(head >> 2);
+    event->x = (int)(replay->lastx + unzigzag(dx));
+    event->y = (int)(replay->lasty + unzigzag(dy));
+    replay->lastms = event->ms;
+    replay->lastx = event->x;
+    replay->lasty = event->y;
+    replay->move++;
+
+    if (event->action == REPLAY_FLAG) {
+        board_flag(board, event->x, event->y);
+    } else if (event->action == REPLAY_CHORD) {
+        board_chord(board, event->x, event->y);
+    } else {
+        board_reveal(board, event->x, event->y);
+    }
+
+    /* Skip the blocks written after this move and note its keyframe */
+    while (c.p < c.end && (*c.p & 3) == KIND_BLOCK) {
+        get_varint(&c);
+        read_block(replay, &c, false);
+    }
+    replay->lastkey = replay->numkeys;
+    if (replay->move % replay->interval == 0 && replay->move / replay->interval <= replay->numkeys) {
+        replay->lastkey = replay->move / replay->interval - 1;
+    }
+    replay->at = (size_t)(c.p - replay->data);
+    return !c.bad;
+}
+
+bool
+replay_verify(const replay_t* replay, board_t* board) {
+    if (replay->params.infinite) {
+        return true;
+    }
+    size_t n = (size_t)replay->params.width * replay->params.height;
+    if (replay->mines && board->generated) {
+        const uint8_t* bits = replay->data + replay->mines;
+        for (size_t i=0; i<n; i++) {
+            if (((bits[i >> 3] >> (i & 7)) & 1) != ((board->cells[i] & CELL_MINE) != 0)) {
+                return false;
+            }
+        }
+    }
+    if (replay->lastkey == replay->numkeys) {
+        return true;
+    }
+    cursor_t c = {replay->data + replay->keys[replay->lastkey].offset, replay->data + replay->size, false, false};
+    get_varint(&c);
+    for (int i=0; i<4; i++) {
+        get_varint(&c);
+    }
+    if ((get_varint(&c) != 0) != board->generated) {
+        return false;
+    }
+    const uint8_t* state = get_bytes(&c, bitmap_size(&replay->params, 2));
+    for (size_t i=0; !c.bad && i<n; i++) {
+        cell_t bits = ((state[i >> 2] >> ((i & 3) * 2)) & 3) << 4;
+        if (bits != (board->cells[i] & (CELL_REVEALED | CELL_FLAG))) {
+            return false;
+        }
+    }
+    return !c.bad;
+}
+
+/*============================================================================*/
+
+static void
+put_bytes(replay_writer_t* w, const void* data, size_t n) {
+    if (w->used + n > WRITE_BUFFER) {
+        if (fwrite(w->buf, 1, w->used, w->file) != w->used) {
+            w->failed = true;
+        }
+        w->used = 0;
+    }
+    if (n > WRITE_BUFFER) {
+        if (fwrite(data, 1, n, w->file) != n) {
+            w->failed = true;
+        }
+        return;
+    }
+    memcpy(w->buf + w->used, data, n);
+    w->used += n;
+}
+
+static void
+put_varint(replay_writer_t* w, uint64_t v) {
+    /* 7 bits per byte, low first, high bit set while more follow */
+    uint8_t bytes[10];
+    int n = 0;
+    do {
+        bytes[n++] = (uint8_t)(v & 0x7F) | (v > 0x7F ? 0x80 : 0);
+        v >>= 7;
+    } while (v);
+    put_bytes(w, bytes, n);
+}
+
+static void
+put_mines(replay_writer_t* w, const board_t* board) {
+    /* The layout is fixed once placed; stored once, packed in one go */
+    size_t n = (size_t)board->width * board->height;
+    size_t size = bitmap_size(&board->params, 1);
+    uint8_t* bits = calloc(size, 1);
+    if (!bits) {
+        w->failed = true;
+        return;
+    }
+    for (size_t i=0; i<n; i++) {
+        bits[i >> 3] |= ((board->cells[i] & CELL_MINE) != 0) << (i & 7);
+    }
+    put_varint(w, KIND_BLOCK);
+    put_varint(w, BLOCK_MINES);
+    put_bytes(w, bits, size);
+    free(bits);
+    w->mineswritten = true;
+}
+
+static void
+put_keyframe(replay_writer_t* w, bool generated) {
+    put_varint(w, KIND_BLOCK);
+    put_varint(w, BLOCK_KEYFRAME);
+    put_varint(w, w->moves);
+    put_varint(w, zigzag(w->lastx));
+    put_varint(w, zigzag(w->lasty));
+    put_varint(w, w->lastms);
+    put_varint(w, generated);
+    put_bytes(w, w->state, w->statesize);
+}
+
+static void
+track(replay_writer_t* w, const board_t* board, int x, int y) {
+    /* Copies one cell's revealed/flag bits into the kept keyframe */
+    size_t i = (size_t)y * board->width + x;
+    int shift = (i & 3) * 2;
+    cell_t bits = (board->cells[i] & (CELL_REVEALED | CELL_FLAG)) >> 4;
+    w->state[i >> 2] = (uint8_t)((w->state[i >> 2] & ~(3 << shift)) | (bits << shift));
+}
+
+static uint64_t
+get_varint(cursor_t* c) {
+    uint64_t v = 0;
+    for (int shift=0; shift<64; shift+=7) {
+        if (c->p >= c->end) {
+            c->bad = c->cut = true;
+            return 0;
+        }
+        uint8_t byte = *c->p++;
+        v |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return v;
+        }
+    }
+    c->bad = true;
+    return 0;
+}
+
+static const uint8_t*
+get_bytes(cursor_t* c, size_t n) {
+    if ((size_t)(c->end - c->p) < n) {
+        c->bad = c->cut = true;
+        return c->p;
+    }
+    const uint8_t* p = c->p;
+    c->p += n;
+    return p;
+}
+
+static uint64_t
+zigzag(int64_t v) {
+    /* Small moves either way become small unsigned numbers */
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+static int64_t
+unzigzag(uint64_t v) {
+    return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+static size_t
+bitmap_size(const board_params_t* params, int bits) {
+    size_t n = (size_t)params->width * params->height;
+    return (n * bits + 7) / 8;
+}
+
+#ifdef _WIN32
+static bool
+map_file(replay_t* replay, const char* path) {
+    LARGE_INTEGER size;
+    replay->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                               FILE_ATTRIBUTE_NORMAL, NULL);
+    if (replay->file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    if (!GetFileSizeEx(replay->file, &size) || size.QuadPart == 0) {
+        CloseHandle(replay->file);
+        return false;
+    }
+    replay->size = replay->mapsize = (size_t)size.QuadPart;
+    replay->mapping = CreateFileMappingA(replay->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    replay->data = replay->mapping ? MapViewOfFile(replay->mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (!replay->data) {
+        if (replay->mapping) {
+            CloseHandle(replay->mapping);
+        }
+        CloseHandle(replay->file);
+        return false;
+    }
+    return true;
+}
+
+static void
+unmap_file(replay_t* replay) {
+    UnmapViewOfFile(replay->data);
+    CloseHandle(replay->mapping);
+    CloseHandle(replay->file);
+}
+#else
+static bool
+map_file(replay_t* replay, const char* path) {
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    if (fstat(fd, &st) || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    replay->size = replay->mapsize = (size_t)st.st_size;
+    void* data = mmap(NULL, replay->mapsize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+    replay->data = data;
+    return true;
+}
+
+static void
+unmap_file(replay_t* replay) {
+    munmap((void*)replay->data, replay->mapsize);
+}
+#endif
+
+static bool
+scan(replay_t* replay) {
+    /* Checks the header and every record once, counting the moves and
+     * indexing the keyframes, so playback can trust the file. A recording
+     * cut short, say by a crash, plays up to its last whole record. */
+    cursor_t c = {replay->data, replay->data + replay->size, false, false};
+    board_params_t* params = &replay->params;
+    const uint8_t* head = get_bytes(&c, 6);
+    if (c.bad || memcmp(head, "MSRP", 4) != 0 || head[4] < 1 || head[4] > REPLAY_VERSION) {
+        return false;
+    }
+    params->infinite = (head[5] & FLAG_INFINITE) != 0;
+    params->noguess = (head[5] & FLAG_NOGUESS) != 0;
+    params->threads = 1;
+    uint64_t width = get_varint(&c);
+    uint64_t height = get_varint(&c);
+    uint64_t nummines = get_varint(&c);
+    uint64_t density = get_varint(&c);
+    params->seed = get_varint(&c);
+    uint64_t interval = get_varint(&c);
+    if (c.bad || width > INT_MAX || height > INT_MAX || nummines > INT_MAX || density > 100
+            || interval == 0 || interval > INT_MAX) {
+        return false;
+    }
+    params->width = (int)width;
+    params->height = (int)height;
+    params->nummines = (int)nummines;
+    params->density = (int)density;
+    replay->interval = (int)interval;
+    replay->records = (size_t)(c.p - replay->data);
+
+    const uint8_t* whole = c.p;
+    while (c.p < c.end) {
+        if ((*c.p & 3) == KIND_BLOCK) {
+            /* Blocks follow a move, or open the recording of a board that
+             * was not new */
+            get_varint(&c);
+            if (!read_block(replay, &c, true)) {
+                break;
+            }
+        } else {
+            get_varint(&c);
+            get_varint(&c);
+            get_varint(&c);
+            if (c.bad) {
+                break;
+            }
+            replay->length++;
+        }
+        whole = c.p;
+    }
+    if (c.cut) {
+        replay->size = (size_t)(whole - replay->data);
+    }
+    return !c.bad || c.cut;
+}
+
+static bool
+read_block(replay_t* replay, cursor_t* c, bool index) {
+    /* Skips a block body, recording where it is when indexing */
+    size_t body = (size_t)(c->p - replay->data);
+    uint64_t kind = get_varint(c);
+    if (replay->params.infinite) {
+        c->bad = true;
+    } else if (kind == BLOCK_MINES) {
+        const uint8_t* bits = get_bytes(c, bitmap_size(&replay->params, 1));
+        if (index && !c->bad) {
+            replay->mines = (size_t)(bits - replay->data);
+        }
+    } else if (kind == BLOCK_KEYFRAME) {
+        uint64_t move = get_varint(c);
+        for (int i=0; i<4; i++) {
+            get_varint(c);
+        }
+        get_bytes(c, bitmap_size(&replay->params, 2));
+        if (index && !c->bad && move == 0 && replay->length == 0 && !replay->start) {
+            replay->start = body;
+        } else if (index && !c->bad) {
+            /* Keyframes come every interval moves, right after the move */
+            if (move != replay->length || move != (replay->numkeys + 1) * (uint64_t)replay->interval) {
+                c->bad = true;
+                return false;
+            }
+            if (replay->numkeys == replay->capkeys) {
+                size_t newcap = replay->capkeys ? replay->capkeys * 2 : 64;
+                keyframe_t* grown = realloc(replay->keys, newcap * sizeof(keyframe_t));
+                if (!grown) {
+                    c->bad = true;
+                    return false;
+                }
+                replay->keys = grown;
+                replay->capkeys = newcap;
+            }
+            replay->keys[replay->numkeys++] = (keyframe_t){(size_t)move, body};
+        }
+    } else {
+        c->bad = true;
+    }
+    return !c->bad;
+}
+
+static bool
+restore(replay_t* replay, board_t* board, const keyframe_t* key) {
+    /* Rebuilds the board from a keyframe and the mine bitmap */
+    cursor_t c = {replay->data + key->offset, replay->data + replay->size, false, false};
+    size_t n = (size_t)replay->params.width * replay->params.height;
+    get_varint(&c);
+    get_varint(&c);
+    int x = (int)unzigzag(get_varint(&c));
+    int y = (int)unzigzag(get_varint(&c));
+    uint32_t ms = (uint32_t)get_varint(&c);
+    bool generated = get_varint(&c) != 0;
+    const uint8_t* state = get_bytes(&c, bitmap_size(&replay->params, 2));
+    if (c.bad || (generated && !replay->mines)) {
+        return false;
+    }
+
+    board_reset(board, replay->params.seed);
+    for (size_t i=0; i<n; i++) {
+        board->cells[i] = ((state[i >> 2] >> ((i & 3) * 2)) & 3) << 4;
+        if (generated && ((replay->data[replay->mines + (i >> 3)] >> (i & 7)) & 1)) {
+            board->cells[i] |= CELL_MINE;
+        }
+    }
+    if (generated) {
+        generate_touching_details(board);
+        board->generated = true;
+        for (size_t i=0; i<n; i++) {
+            if ((board->cells[i] & (CELL_REVEALED | CELL_MINE)) == (CELL_REVEALED | CELL_MINE)) {
+                board->status = BOARD_LOST;
+            } else if (board->cells[i] & CELL_REVEALED) {
+                board->numrevealed++;
+            }
+        }
+        if (board->status == BOARD_PLAYING && board->numrevealed == n - board->params.nummines) {
+            board->status = BOARD_WON;
+        }
+    }
+
+    replay->at = (size_t)(c.p - replay->data);
+    replay->move = key->move;
+    replay->lastx = x;
+    replay->lasty = y;
+    replay->lastms = ms;
+    return true;
+}
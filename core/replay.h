@@ -0,0 +1,69 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+/* Compact binary game recordings. A replay holds the board parameters and
+ * every move with its time. Moves are delta and varint encoded, usually 3
+ * bytes each. Fixed boards also store the mine layout once and a keyframe
+ * of the revealed/flag bits every few moves, so any move can be reached
+ * by decoding at most one keyframe interval. A board recorded from the
+ * middle of a game, e.g. a loaded save, starts with its layout and a
+ * keyframe at move 0. Replays are read through a memory map.
+ *
+ * Layout, all integers LEB128 varints unless noted:
+ *   "MSRP", u8 version, u8 flags (1 infinite, 2 no-guess)
+ *   width, height, nummines, density, seed, keyframe interval
+ *   records: (dt_ms << 2 | kind), then
+ *     kind 0-2 (reveal, flag, chord): zigzag dx, zigzag dy from the last move
+ *     kind 3 (block): 0 and a mine bitmap, 1 bit per cell
+ *                     1, move number, x, y, time, generated flag, then 2 bits
+ *                     (revealed, flag) per cell */
+
+#include "board.h"
+
+#define REPLAY_VERSION (2)     // 2 added the move 0 keyframe; 1 still reads
+#define REPLAY_INTERVAL (64)    // default moves between keyframes
+
+typedef enum {
+    REPLAY_REVEAL,
+    REPLAY_FLAG,
+    REPLAY_CHORD,
+} replay_action_t;
+
+typedef struct {
+    replay_action_t action;
+    int x, y;
+    uint32_t ms;        // time since the recording started
+} replay_event_t;
+
+typedef struct replay_writer replay_writer_t;
+typedef struct replay replay_t;
+
+/* Streaming writer. Moves go into a buffer that is written out as it
+ * fills, so recording costs a few bytes of encoding per move. Recording
+ * starts from board as it is now. Returns NULL if the file cannot be
+ * created. */
+replay_writer_t* replay_create(const char* path, const board_t* board, int interval);
+/* Records a move just applied to board; the keyframes are kept up to date
+ * from board_changes, so every move must be recorded before the next */
+void replay_record(replay_writer_t* writer, const board_t* board, replay_action_t action,
+                   int x, int y, uint32_t ms);
+/* Flushes and closes; returns false if anything failed to write */
+bool replay_finish(replay_writer_t* writer);
+
+/* Maps a replay; returns NULL if it cannot be read or is malformed */
+replay_t* replay_open(const char* path);
+void replay_close(replay_t* replay);
+const board_params_t* replay_params(const replay_t* replay);
+size_t replay_length(const replay_t* replay);
+
+/* Puts board (made from replay_params) in its state after the first move
+ * moves, from the nearest keyframe; move 0 is the start of the recording.
+ * Returns false on a corrupt replay. */
+bool replay_seek(replay_t* replay, board_t* board, size_t move);
+/* Applies the next move to board. Returns false at the end. */
+bool replay_step(replay_t* replay, board_t* board, replay_event_t* event);
+/* Checks board against the keyframe recorded after the last move stepped,
+ * if there is one. Returns false on a mismatch. */
+bool replay_verify(const replay_t* replay, board_t* board);
+
+#endif
@@ -0,0 +1,47 @@
+#include "rng.h"
+
+void
+rng_seed(rng_t* rng, uint64_t seed) {
+    /* Expand the seed with splitmix64 so nearby seeds give unrelated streams */
+    for (int i=0; i<4; i++) {
+        uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        rng->s[i] = z ^ (z >> 31);
+    }
+}
+
+uint64_t
+rng_next(rng_t* rng) {
+    /* xoshiro256** */
+    uint64_t* s = rng->s;
+    uint64_t x = s[1] * 5;
+    uint64_t result = ((x << 7) | (x >> 57)) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 45) | (s[3] >> 19);
+    return result;
+}
+
+uint64_t
+rng_below(rng_t* rng, uint64_t n) {
+    /* Multiply-shift maps 64 random bits onto [0,n) without a division:
+     * the high half of the 128-bit product. Targets without a 128-bit type
+     * (32-bit GCC, i686 MinGW) build it from 32-bit halves, giving the
+     * same value, so a seed makes the same board everywhere. */
+    uint64_t x = rng_next(rng);
+#ifdef __SIZEOF_INT128__
+    return (uint64_t)(((unsigned __int128)x * n) >> 64);
+#else
+    uint64_t xlo = (uint32_t)x, xhi = x >> 32;
+    uint64_t nlo = (uint32_t)n, nhi = n >> 32;
+    uint64_t lo = xlo * nlo;
+    uint64_t mid1 = xhi * nlo + (lo >> 32);
+    uint64_t mid2 = xlo * nhi + (uint32_t)mid1;
+    return xhi * nhi + (mid1 >> 32) + (mid2 >> 32);
+#endif
+}
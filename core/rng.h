@@ -0,0 +1,16 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+/* xoshiro256** seeded through splitmix64. Small, fast and, unlike rand(),
+ * the same on every platform for a given seed. */
+typedef struct {
+    uint64_t s[4];
+} rng_t;
+
+void rng_seed(rng_t* rng, uint64_t seed);
+uint64_t rng_next(rng_t* rng);
+uint64_t rng_below(rng_t* rng, uint64_t n);
+
+#endif
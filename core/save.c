@@ -0,0 +1,290 @@
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "board_impl.h"
+
+/*============================================================================*/
+
+#define SAVE_VERSION (1)
+#define SAVE_ALIGN (4096)   // the cell store starts on a page boundary
+
+/* First page of a save file. The packed cells follow at offset cells, one
+ * byte each, row-major, exactly as board->cells holds them, so a mapped
+ * file is the board's store with no parsing. Native byte order. */
+typedef struct {
+    char magic[8];      // "MSBOARD" and a zero
+    uint32_t version;
+    uint32_t cells;     // offset of the cell store
+    int32_t width, height, nummines;
+    int32_t threads;
+    uint64_t seed;
+    uint64_t numrevealed;
+    uint8_t generated, status, noguess;
+    uint8_t clean;      // counts match the cells; cleared while mapped
+} saveheader_t;
+
+/*============================================================================*/
+static void fill_header(const board_t* board, saveheader_t* header);
+static bool map_save(board_t* board, const char* path);
+static bool flush_save(board_t* board, bool all);
+/*================================================*/
+
+bool
+board_save(board_t* board, const char* path) {
+    /* A board mapped from path only needs its dirty pages written. Any
+     * other board is written out in full, then mapped so that later saves
+     * are incremental too. */
+    if (board->params.infinite) {
+        return false;
+    }
+    if (board->map && strcmp(board->path, path) == 0) {
+        return flush_save(board, true);
+    }
+
+    /* Written beside the target and renamed over it, so a crash never
+     * leaves a half written save and a mapped target is never truncated */
+    saveheader_t header;
+    size_t n = (size_t)board->width * board->height;
+    uint8_t* page = calloc(1, SAVE_ALIGN);
+    char* temp = malloc(strlen(path) + 5);
+    FILE* file = NULL;
+    if (page && temp) {
+        strcpy(temp, path);
+        strcat(temp, ".tmp");
+        file = fopen(temp, "wb");
+    }
+    if (!file) {
+        free(page);
+        free(temp);
+        return false;
+    }
+    fill_header(board, &header);
+    header.clean = 1;
+    memcpy(page, &header, sizeof(header));
+    bool ok = fwrite(page, 1, SAVE_ALIGN, file) == SAVE_ALIGN && fwrite(board->cells, 1, n, file) == n;
+    ok = !fclose(file) && ok;
+    free(page);
+#ifdef _WIN32
+    ok = ok && MoveFileExA(temp, path, MOVEFILE_REPLACE_EXISTING);
+#else
+    ok = ok && rename(temp, path) == 0;
+#endif
+    if (!ok) {
+        remove(temp);
+    }
+    free(temp);
+    if (!ok) {
+        return false;
+    }
+
+    /* Swap the old store, heap or another file, for the new file */
+    board_t fresh = {0};
+    if (!map_save(&fresh, path)) {
+        return false;
+    }
+    cell_t* heap = board->map ? NULL : board->cells;
+    board_unmap(board);
+    free(heap);
+    board->map = fresh.map;
+    board->mapsize = fresh.mapsize;
+    board->path = fresh.path;
+    board->cells = fresh.cells;
+#ifdef _WIN32
+    board->file = fresh.file;
+    board->mapping = fresh.mapping;
+#endif
+    ((saveheader_t*)board->map)->clean = 0;
+    return flush_save(board, false);
+}
+
+board_t*
+board_load(const char* path) {
+    /* Maps the file and uses it as the cell store. Only the header is
+     * read now; cell pages fault in as they are touched, so opening takes
+     * the same time whatever the board size. Nothing is written unless the
+     * file checks out as a save. */
+    board_t* board = calloc(1, sizeof(board_t));
+    if (!board) {
+        return NULL;
+    }
+    if (!map_save(board, path)) {
+        free(board);
+        return NULL;
+    }
+    saveheader_t* header = board->map;
+    board->params.width = board->width = header->width;
+    board->params.height = board->height = header->height;
+    board->params.nummines = header->nummines;
+    board->params.threads = header->threads;
+    board->params.seed = header->seed;
+    board->params.noguess = header->noguess != 0;
+    board->generated = header->generated != 0;
+    board->status = header->status;
+    board->numrevealed = header->numrevealed;
+
+    size_t n = (size_t)board->width * board->height;
+    if (!header->clean) {
+        /* The last session ended without closing the board, so the counts
+         * may be behind the cells. Recount them. */
+        board->numrevealed = 0;
+        board->status = BOARD_PLAYING;
+        for (size_t i=0; i<n; i++) {
+            if ((board->cells[i] & (CELL_REVEALED | CELL_MINE)) == (CELL_REVEALED | CELL_MINE)) {
+                board->status = BOARD_LOST;
+            } else if (board->cells[i] & CELL_REVEALED) {
+                board->numrevealed++;
+            }
+        }
+        if (board->status == BOARD_PLAYING && board->numrevealed == n - board->params.nummines) {
+            board->status = BOARD_WON;
+        }
+    }
+    /* Moves now reach the file directly; mark it until it is closed */
+    header->clean = 0;
+    if (!flush_save(board, false)) {
+        board_free(board);
+        return NULL;
+    }
+    return board;
+}
+
+void
+board_unmap(board_t* board) {
+    /* Writes the counts back, marks the file clean and unmaps it */
+    if (!board->map) {
+        return;
+    }
+    ((saveheader_t*)board->map)->clean = 1;
+    flush_save(board, true);
+#ifdef _WIN32
+    UnmapViewOfFile(board->map);
+    CloseHandle(board->mapping);
+    CloseHandle(board->file);
+#else
+    munmap(board->map, board->mapsize);
+#endif
+    free(board->path);
+    board->map = NULL;
+    board->path = NULL;
+    board->cells = NULL;
+}
+
+/*============================================================================*/
+
+static void
+fill_header(const board_t* board, saveheader_t* header) {
+    memset(header, 0, sizeof(saveheader_t));
+    memcpy(header->magic, "MSBOARD", 8);
+    header->version = SAVE_VERSION;
+    header->cells = SAVE_ALIGN;
+    header->width = board->width;
+    header->height = board->height;
+    header->nummines = board->params.nummines;
+    header->threads = board->params.threads;
+    header->seed = board->params.seed;
+    header->numrevealed = board->numrevealed;
+    header->generated = board->generated;
+    header->status = (uint8_t)board->status;
+    header->noguess = board->params.noguess;
+}
+
+static bool
+map_save(board_t* board, const char* path) {
+    /* Maps a save file read/write and points the board's cells into it */
+    size_t size;
+#ifdef _WIN32
+    LARGE_INTEGER filesize;
+    board->file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (board->file == INVALID_HANDLE_VALUE) {
+        DWORD err = GetLastError();
+        errno = err == ERROR_FILE_NOT_FOUND || err == ERROR_PATH_NOT_FOUND ? ENOENT : EACCES;
+        return false;
+    }
+    if (!GetFileSizeEx(board->file, &filesize) || (uint64_t)filesize.QuadPart < SAVE_ALIGN) {
+        CloseHandle(board->file);
+        errno = EINVAL;
+        return false;
+    }
+    size = (size_t)filesize.QuadPart;
+    board->mapping = CreateFileMappingA(board->file, NULL, PAGE_READWRITE, 0, 0, NULL);
+    board->map = board->mapping ? MapViewOfFile(board->mapping, FILE_MAP_WRITE, 0, 0, 0) : NULL;
+    if (!board->map) {
+        if (board->mapping) {
+            CloseHandle(board->mapping);
+        }
+        CloseHandle(board->file);
+        errno = ENOMEM;
+        return false;
+    }
+#else
+    struct stat st;
+    int fd = open(path, O_RDWR);
+    if (fd < 0) {
+        return false;
+    }
+    if (fstat(fd, &st) || (uint64_t)st.st_size < SAVE_ALIGN) {
+        close(fd);
+        errno = EINVAL;
+        return false;
+    }
+    size = (size_t)st.st_size;
+    void* map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+    board->map = map;
+#endif
+    board->mapsize = size;
+
+    /* The header must describe exactly the cells that follow it */
+    saveheader_t* header = board->map;
+    uint64_t n = (uint64_t)(header->width > 0 ? header->width : 0) * (header->height > 0 ? header->height : 0);
+    board->path = malloc(strlen(path) + 1);
+    int err = board->path ? EINVAL : ENOMEM;
+    if (!board->path || memcmp(header->magic, "MSBOARD", 8) != 0 || header->version != SAVE_VERSION
+            || header->cells != SAVE_ALIGN || header->status > BOARD_LOST || n == 0 || header->nummines < 0
+            || (uint64_t)header->nummines >= n || size != SAVE_ALIGN + n) {
+        free(board->path);
+        board->path = NULL;
+#ifdef _WIN32
+        UnmapViewOfFile(board->map);
+        CloseHandle(board->mapping);
+        CloseHandle(board->file);
+#else
+        munmap(board->map, size);
+#endif
+        board->map = NULL;
+        errno = err;
+        return false;
+    }
+    strcpy(board->path, path);
+    board->cells = (cell_t*)((uint8_t*)board->map + SAVE_ALIGN);
+    return true;
+}
+
+static bool
+flush_save(board_t* board, bool all) {
+    /* Brings the header's counts up to date and forces dirty pages out:
+     * just the header, or the whole mapping, of which the OS only writes
+     * the pages that changed */
+    saveheader_t* header = board->map;
+    uint8_t clean = header->clean;
+    fill_header(board, header);
+    header->clean = clean;
+    size_t size = all ? board->mapsize : SAVE_ALIGN;
+#ifdef _WIN32
+    return FlushViewOfFile(board->map, size) && FlushFileBuffers(board->file);
+#else
+    return msync(board->map, size, MS_SYNC) == 0;
+#endif
+}
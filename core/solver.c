@@ -0,0 +1,276 @@
+#include <stdlib.h>
+#include <string.h>
+#include "board_impl.h"
+#include "solver.h"
+
+/*============================================================================*/
+
+#define KNOWN_MASK (0x03)   // solver_known_t of the cell
+#define QUEUED (0x04)       // revealed number waiting to be re-examined
+
+/* The hidden, undecided neighbours of a revealed number and how many of
+ * them are mines */
+typedef struct {
+    coord_t cells[8];
+    int num;
+    int mines;
+} constraint_t;
+
+struct solver {
+    board_t* board;
+    uint8_t* state;     // known state and queue flag per cell
+    coord_t* queue;     // numbers whose neighbourhood changed
+    size_t numqueue, capqueue;
+    coord_t* safe;      // deduced safe cells, some may be revealed since
+    size_t numsafe, capsafe;
+    coord_t* mines;     // deduced mines
+    size_t nummines, capmines;
+};
+
+/*============================================================================*/
+static void enqueue(solver_t* solver, int x, int y);
+static void enqueue_around(solver_t* solver, int x, int y);
+static void decide(solver_t* solver, coord_t c, solver_known_t known);
+static bool constraint_at(solver_t* solver, int x, int y, constraint_t* con);
+static bool contains(const constraint_t* con, coord_t c);
+static void apply_subset(solver_t* solver, const constraint_t* small, const constraint_t* big);
+static void examine(solver_t* solver, int x, int y);
+/*================================================*/
+
+solver_t*
+solver_new(board_t* board) {
+    if (board->params.infinite) {
+        return NULL;
+    }
+    solver_t* solver = calloc(1, sizeof(solver_t));
+    if (!solver) {
+        return NULL;
+    }
+    solver->board = board;
+    solver->state = calloc((size_t)board->width * board->height, 1);
+    if (!solver->state) {
+        free(solver);
+        return NULL;
+    }
+    return solver;
+}
+
+void
+solver_free(solver_t* solver) {
+    if (!solver) {
+        return;
+    }
+    free(solver->state);
+    free(solver->queue);
+    free(solver->safe);
+    free(solver->mines);
+    free(solver);
+}
+
+void
+solver_reset(solver_t* solver) {
+    memset(solver->state, 0, (size_t)solver->board->width * solver->board->height);
+    solver->numqueue = 0;
+    solver->numsafe = 0;
+    solver->nummines = 0;
+}
+
+void
+solver_update(solver_t* solver, const coord_t* changed, size_t num) {
+    /* A newly revealed number is a new constraint, and every revealed
+     * number next to it has lost a hidden neighbour */
+    for (size_t i=0; i<num; i++) {
+        int x = changed[i].x;
+        int y = changed[i].y;
+        if (solver->board->cells[(size_t)y*solver->board->width + x] & CELL_REVEALED) {
+            enqueue(solver, x, y);
+            enqueue_around(solver, x, y);
+        }
+    }
+    /* Work until no examined number yields anything new. Deductions
+     * enqueue their revealed neighbours, so this stays local. */
+    while (solver->numqueue > 0) {
+        coord_t c = solver->queue[--solver->numqueue];
+        solver->state[(size_t)c.y*solver->board->width + c.x] &= ~QUEUED;
+        examine(solver, c.x, c.y);
+    }
+}
+
+bool
+solver_next_safe(solver_t* solver, coord_t* cell) {
+    /* Drop deductions the player has revealed in the meantime */
+    while (solver->numsafe > 0) {
+        coord_t c = solver->safe[solver->numsafe - 1];
+        if (!(solver->board->cells[(size_t)c.y*solver->board->width + c.x] & CELL_REVEALED)) {
+            *cell = c;
+            return true;
+        }
+        solver->numsafe--;
+    }
+    return false;
+}
+
+const coord_t*
+solver_mines(const solver_t* solver, size_t* num) {
+    *num = solver->nummines;
+    return solver->mines;
+}
+
+solver_known_t
+solver_known(const solver_t* solver, int x, int y) {
+    if (x<0 || x>=solver->board->width || y<0 || y>=solver->board->height) {
+        return SOLVER_UNKNOWN;
+    }
+    return solver->state[(size_t)y*solver->board->width + x] & KNOWN_MASK;
+}
+
+/*============================================================================*/
+
+static void
+enqueue(solver_t* solver, int x, int y) {
+    board_t* board = solver->board;
+    if (x<0 || x>=board->width || y<0 || y>=board->height) {
+        return;
+    }
+    size_t i = (size_t)y*board->width + x;
+    cell_t cell = board->cells[i];
+    /* Only revealed numbers carry a constraint */
+    if (!(cell & CELL_REVEALED) || (cell & CELL_MINE) || (solver->state[i] & QUEUED)) {
+        return;
+    }
+    solver->state[i] |= QUEUED;
+    push_coord(&solver->queue, &solver->numqueue, &solver->capqueue, (coord_t){x, y});
+}
+
+static void
+enqueue_around(solver_t* solver, int x, int y) {
+    for (int dy=-1; dy<=1; dy++) {
+        for (int dx=-1; dx<=1; dx++) {
+            if (dx || dy) {
+                enqueue(solver, x+dx, y+dy);
+            }
+        }
+    }
+}
+
+static void
+decide(solver_t* solver, coord_t c, solver_known_t known) {
+    uint8_t* state = &solver->state[(size_t)c.y*solver->board->width + c.x];
+    if ((*state & KNOWN_MASK) != SOLVER_UNKNOWN) {
+        return;
+    }
+    *state |= known;
+    if (known == SOLVER_SAFE) {
+        push_coord(&solver->safe, &solver->numsafe, &solver->capsafe, c);
+    } else {
+        push_coord(&solver->mines, &solver->nummines, &solver->capmines, c);
+    }
+    /* Every number around it now has one fewer unknown */
+    enqueue_around(solver, c.x, c.y);
+}
+
+static bool
+constraint_at(solver_t* solver, int x, int y, constraint_t* con) {
+    /* Builds the constraint of the revealed number at (x,y). Returns false
+     * if there is none or nothing about it is undecided. */
+    board_t* board = solver->board;
+    if (x<0 || x>=board->width || y<0 || y>=board->height) {
+        return false;
+    }
+    cell_t cell = board->cells[(size_t)y*board->width + x];
+    if (!(cell & CELL_REVEALED) || (cell & CELL_MINE)) {
+        return false;
+    }
+    con->num = 0;
+    con->mines = cell & CELL_COUNT;
+    for (int dy=-1; dy<=1; dy++) {
+        for (int dx=-1; dx<=1; dx++) {
+            int nx = x + dx;
+            int ny = y + dy;
+            if ((!dx && !dy) || nx<0 || nx>=board->width || ny<0 || ny>=board->height) {
+                continue;
+            }
+            size_t i = (size_t)ny*board->width + nx;
+            if (board->cells[i] & CELL_REVEALED) {
+                /* A mine the player stepped on is known */
+                if (board->cells[i] & CELL_MINE) {
+                    con->mines--;
+                }
+                continue;
+            }
+            int known = solver->state[i] & KNOWN_MASK;
+            if (known == SOLVER_MINE) {
+                con->mines--;
+            } else if (known == SOLVER_UNKNOWN) {
+                con->cells[con->num++] = (coord_t){nx, ny};
+            }
+        }
+    }
+    return con->num > 0;
+}
+
+static bool
+contains(const constraint_t* con, coord_t c) {
+    for (int i=0; i<con->num; i++) {
+        if (con->cells[i].x == c.x && con->cells[i].y == c.y) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void
+apply_subset(solver_t* solver, const constraint_t* small, const constraint_t* big) {
+    /* If small's cells all lie in big, the cells only big has hold exactly
+     * big.mines - small.mines mines */
+    coord_t rest[8];
+    int numrest = 0;
+    for (int i=0; i<small->num; i++) {
+        if (!contains(big, small->cells[i])) {
+            return;
+        }
+    }
+    for (int i=0; i<big->num; i++) {
+        if (!contains(small, big->cells[i])) {
+            rest[numrest++] = big->cells[i];
+        }
+    }
+    int mines = big->mines - small->mines;
+    if (numrest == 0 || (mines != 0 && mines != numrest)) {
+        return;
+    }
+    for (int i=0; i<numrest; i++) {
+        decide(solver, rest[i], mines == 0 ? SOLVER_SAFE : SOLVER_MINE);
+    }
+}
+
+static void
+examine(solver_t* solver, int x, int y) {
+    constraint_t con, other;
+    if (!constraint_at(solver, x, y, &con)) {
+        return;
+    }
+
+    /* Single point: every unknown is safe, or every unknown is a mine */
+    if (con.mines == 0 || con.mines == con.num) {
+        solver_known_t known = con.mines == 0 ? SOLVER_SAFE : SOLVER_MINE;
+        for (int i=0; i<con.num; i++) {
+            decide(solver, con.cells[i], known);
+        }
+        return;
+    }
+
+    /* Subset/difference against every number that can share a cell */
+    for (int dy=-2; dy<=2; dy++) {
+        for (int dx=-2; dx<=2; dx++) {
+            if ((dx || dy) && constraint_at(solver, x+dx, y+dy, &other)) {
+                apply_subset(solver, &con, &other);
+                apply_subset(solver, &other, &con);
+                /* A deduction may have changed our own constraint */
+                if (!constraint_at(solver, x, y, &con)) {
+                    return;
+                }
+            }
+        }
+    }
+}
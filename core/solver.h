@@ -0,0 +1,37 @@
+#ifndef SOLVER_H
+#define SOLVER_H
+
+/* Incremental constraint solver. It is fed the change set of every move
+ * and only re-examines the revealed numbers those changes touch, so the
+ * cost of a move depends on the local frontier change, never the board
+ * size. Each number is a constraint on its hidden neighbours; the solver
+ * applies the single-point rule (all mines or all safe) and the subset
+ * rule between overlapping numbers. Fixed-size boards only. */
+
+#include "board.h"
+
+typedef enum {
+    SOLVER_UNKNOWN,
+    SOLVER_SAFE,
+    SOLVER_MINE,
+} solver_known_t;
+
+typedef struct solver solver_t;
+
+/* Returns NULL for infinite boards or when memory runs out */
+solver_t* solver_new(board_t* board);
+void solver_free(solver_t* solver);
+/* Forgets everything, for use after board_reset */
+void solver_reset(solver_t* solver);
+
+/* Feeds the cells changed by a move */
+void solver_update(solver_t* solver, const coord_t* changed, size_t num);
+
+/* Finds a hidden cell known to be safe, without consuming it. Returns
+ * false when no deduction is left. */
+bool solver_next_safe(solver_t* solver, coord_t* cell);
+/* Every cell deduced to be a mine so far */
+const coord_t* solver_mines(const solver_t* solver, size_t* num);
+solver_known_t solver_known(const solver_t* solver, int x, int y);
+
+#endif
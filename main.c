@@ -1,82 +1,180 @@
 #include <time.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <stdint.h>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL_image.h>
 #include <assert.h>
+#include "core/board.h"
+#include "core/solver.h"
+#include "core/prob.h"
+#include "core/replay.h"
+#include "perf.h"
+#include "resources/atlas.h"
 
 
 /*============================================================================*/
 
 #define CELLSIZE (40)       // size of one cell in px
-#define GRID_HEIGHT (21)    // number of cells y-dir
-#define GRID_WIDTH (21)     // number of cells x-dir
-#define WINDOW_HEIGHT (CELLSIZE*GRID_HEIGHT + 1)   // size of window y-dir
-#define WINDOW_WIDTH (CELLSIZE*GRID_WIDTH + 1)    // size of window x-dir
-#define NUM_MINES (75)      // number of mines on the board
+#define DEFAULT_HEIGHT (21) // number of cells y-dir unless given with -h
+#define DEFAULT_WIDTH (21)  // number of cells x-dir unless given with -w
+#define DEFAULT_MINES (75)  // number of mines on the board unless given with -m
+#define MAX_WINDOW (1600)   // largest initial window size in px along either axis
+#define MIN_ZOOM (0.1)      // smallest zoom, cells are 4px on screen
+#define MAX_ZOOM (4.0)      // largest zoom
+#define ZOOM_STEP (1.25)    // zoom factor per wheel notch or key press
+#define PAN_STEP (CELLSIZE*2)   // px moved per arrow key press at zoom 1
+#define DEFAULT_DENSITY (18)    // percent of mines on an infinite board
+#define HUD_PIXEL (2)       // screen px per font pixel in the HUD
+#define HUD_LINES (5)
+#define HUD_REFRESH (250)   // ms between HUD updates
 
 /*============================================================================*/
-typedef struct {
-    SDL_Surface* mine;
-    SDL_Surface* hitmine;
-    SDL_Surface* def;
-    SDL_Surface* flag;
-    SDL_Surface *zero, *one, *two, *three, *four, *five, *six, *seven, *eight;
-} surfaces_t;
-
-typedef struct {
-    SDL_Texture* mine;
-    SDL_Texture* hitmine;
-    SDL_Texture* def;
-    SDL_Texture* flag;
-    SDL_Texture *zero, *one, *two, *three, *four, *five, *six, *seven, *eight;
-} textures_t;
-
-typedef struct {
-    SDL_bool clicked;
-    SDL_bool isflag;
-    SDL_bool ismine;
-    int numtouching;
-} state_t;
+/* Every cell sprite lives in one atlas texture, one CELLSIZE square each,
+ * laid out left to right in this order. The counts come first so a
+ * revealed cell's sprite is its count. */
+enum {
+    SPRITE_ZERO, SPRITE_ONE, SPRITE_TWO, SPRITE_THREE, SPRITE_FOUR,
+    SPRITE_FIVE, SPRITE_SIX, SPRITE_SEVEN, SPRITE_EIGHT,
+    SPRITE_DEF, SPRITE_FLAG, SPRITE_MINE, SPRITE_HITMINE,
+    NUM_SPRITES
+};
 
 typedef struct {
-    SDL_Rect pos;
-    state_t state;
-} cell_t;
+    SDL_Vertex* verts;  // 4 per quad
+    int* indices;       // 6 per quad, two triangles
+    int numquads, capquads;
+} batch_t;
 
 typedef struct {
-    SDL_bool active;
     SDL_bool hover;
-    SDL_bool rightclick;
 } mouse_t;
 
+typedef struct {
+    double x, y;        // board px shown at the window's top left corner
+    double zoom;        // screen px per board px
+} camera_t;
+
 typedef struct {
     SDL_Window* window;
     SDL_Renderer* render;
-    surfaces_t surfaces;
-    textures_t textures;
-    cell_t board[GRID_HEIGHT][GRID_WIDTH];
-    cell_t current;
+    SDL_Surface* atlassurface;  // sprites loaded with -t, freed once uploaded
+    SDL_Texture* atlas;
+    uint8_t sprites[CELL_STATES];   // sprite to draw for each packed cell value
+    batch_t batch;      // quads waiting for the next draw_cells submit
+    batch_t overlay;    // untextured heatmap quads drawn over the cells
+    board_t* board;
+    solver_t* solver;   // fixed boards only, made on first use
+    prob_t* prob;       // fixed boards only, made on first use
+    const char* savepath;   // board file, saved on F5 and on quit
+    SDL_bool heatmap;   // tint hidden cells by their mine probability
+    replay_writer_t* recorder;  // every move goes here when recording
+    Uint32 recordstart; // ticks when recording started
+    perf_t* perf;       // frame and click timings, always collected
+    const char* perfpath;   // timings written here on quit
+    SDL_bool showhud;   // timings drawn over the view
+    Uint32 hudticks;    // ticks when the HUD text was last updated
+    char hud[HUD_LINES][64];
+    coord_t current;
+    coord_t hint;       // safe cell picked by the solver
+    SDL_bool showhint;  // highlight the hint until the next move
+    camera_t camera;
+    int winw, winh;     // window size in px
+    SDL_Texture* target;    // persistent copy of the drawn view
+    coord_t* dirty;     // cells changed since they were last drawn
+    size_t numdirty, capdirty;
+    SDL_bool redraw;    // target contents lost, draw every visible cell
+    SDL_bool present;   // target changed or window exposed since last present
     SDL_bool hasquit;
 } game_t;
 
 /*============================================================================*/
-void load_surfaces(game_t* game);
-void generate_mines(game_t* game);
-void init_cell_details(game_t* game);
-void generate_touching_details(game_t* game);
+int parse_args(int argc, char** argv, board_params_t* params, const char** record, const char** save,
+               const char** perf, SDL_bool* vsync, const char** sprites);
+void load_surfaces(game_t* game, const char* dir);
 void init_tx(game_t* game);
-void draw_cells(game_t* game, mouse_t* mouse);
-void clear_zeros(game_t* game);
+void batch_quad(batch_t* batch, float x, float y, float size, int sprite, SDL_Color color);
+int batch_flush(SDL_Renderer* render, SDL_Texture* atlas, batch_t* batch);
+int create_target(game_t* game);
+void screen_to_cell(game_t* game, int sx, int sy, coord_t* cell);
+void visible_cells(game_t* game, coord_t* first, coord_t* last);
+void camera_pan(game_t* game, double dx, double dy);
+void camera_zoom(game_t* game, double factor, int sx, int sy);
+void handle_event(game_t* game, mouse_t* mouse, SDL_Event* event);
+int next_wake(game_t* game);
+void handle_key(game_t* game, SDL_Keycode key);
+void handle_click(game_t* game, SDL_bool rightclick);
+void draw_cell(game_t* game, int x, int y);
+void draw_cells(game_t* game);
+void push_dirty(game_t* game, const coord_t* cells, size_t num);
+SDL_bool start_helpers(game_t* game);
+void show_hint(game_t* game);
+void auto_flag(game_t* game);
+void record_move(game_t* game, replay_action_t action, int x, int y);
+void update_heatmap(game_t* game);
+void draw_hint(game_t* game);
+void update_hud(game_t* game);
+void draw_text(game_t* game, float x, float y, const char* text);
+void draw_hud(game_t* game);
 /*================================================*/
 
 int
 main(int argc, char** argv) {
 
-    srand(time(NULL)); // For random mine generation
-    game_t game;
+    game_t game = {0};
     mouse_t mouse;
+    board_params_t params;
+    const char* record = NULL;
+    SDL_bool vsync = SDL_FALSE;
+    const char* sprites = NULL;
+
+    /* Read board dimensions and mine count from the command line */
+    if (parse_args(argc, argv, &params, &record, &game.savepath, &game.perfpath, &vsync, &sprites)) {
+        printf("Usage: %s [-w width] [-h height] [-m mines] [-s seed] [-g] [-i [-d density%%]] [-r replay] [-f board]"
+               " [-p timings.csv|.json] [-v] [-t spritedir]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    /* A saved board is mapped as it is, whatever its size. Only a path
+     * that does not exist yet starts a new board to be saved there; any
+     * other file is never overwritten with a fresh game. */
+    if (game.savepath) {
+        errno = 0;
+        game.board = board_load(game.savepath);
+        if (!game.board && errno != ENOENT) {
+            printf("Error loading %s: %s\n", game.savepath,
+                   errno == EINVAL ? "not a board file" : strerror(errno));
+            return EXIT_FAILURE;
+        }
+    }
+    if (game.board) {
+        params = *board_params(game.board);
+        printf("Loaded %s\n", game.savepath);
+    } else {
+        game.board = board_new(&params);
+    }
+    if (!game.board) {
+        printf("Error allocating a %dx%d board\n", params.width, params.height);
+        return EXIT_FAILURE;
+    }
+    printf("Seed: %llu\n", (unsigned long long)params.seed);
+    if (record) {
+        game.recorder = replay_create(record, game.board, REPLAY_INTERVAL);
+        if (!game.recorder) {
+            printf("Error creating replay %s\n", record);
+            return EXIT_FAILURE;
+        }
+        game.recordstart = SDL_GetTicks();
+    }
+    game.perf = perf_new();
+    if (!game.perf) {
+        printf("Error allocating frame timings\n");
+        return EXIT_FAILURE;
+    }
+
     /* Initialise SDL  */
     if (SDL_Init(SDL_INIT_VIDEO)) {
         printf("Error init: %s\n", SDL_GetError());
@@ -87,9 +185,9 @@ main(int argc, char** argv) {
     game.window = SDL_CreateWindow("Minesweeper",
                                         SDL_WINDOWPOS_CENTERED,
                                         SDL_WINDOWPOS_CENTERED,
-                                        WINDOW_WIDTH,
-                                        WINDOW_HEIGHT,
-                                        0);
+                                        (int)SDL_min(CELLSIZE*(long long)params.width + 1, MAX_WINDOW),
+                                        (int)SDL_min(CELLSIZE*(long long)params.height + 1, MAX_WINDOW),
+                                        SDL_WINDOW_RESIZABLE);
 
     /* Check if the window was created successfully */
     if (!game.window) {
@@ -101,7 +199,8 @@ main(int argc, char** argv) {
 
     /* Create renderer */
     game.render = SDL_CreateRenderer(
-                                game.window, -1, SDL_RENDERER_ACCELERATED);
+                                game.window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_TARGETTEXTURE
+                                | (vsync ? SDL_RENDERER_PRESENTVSYNC : 0));
 
     /* Check renderer was created successfully*/
     if (!game.render) {
@@ -113,384 +212,810 @@ main(int argc, char** argv) {
     }
 
     /* Load in surfaces */
-    load_surfaces(&game);
-
-    /* Generate mine details */
-    generate_mines(&game);
-
-    /* Initialise cell details (position, states etc) */
-    init_cell_details(&game);
-
+    load_surfaces(&game, sprites);
 
     /* Load in textures */
     init_tx(&game);
 
+    /* Cells are drawn into a texture that persists between frames, so
+     * only cells that changed ever need drawing again */
+    game.camera.zoom = 1.0;
+    if (create_target(&game)) {
+        printf("Error target init: %s\n", SDL_GetError());
+        SDL_DestroyRenderer(game.render);
+        SDL_DestroyWindow(game.window);
+        SDL_Quit();
+        return EXIT_FAILURE;
+    }
+
     /* Initialise mouse details */
-    mouse.active = SDL_FALSE;
     mouse.hover = SDL_FALSE;
 
-    /* Animation loop */
+    /* Event loop. Sleeps until an event arrives or the HUD is due, handles
+     * everything queued, then draws and presents only if something changed,
+     * so an idle window costs no CPU and a click shows on the next frame.
+     * With -v presents wait for vsync, which paces continuous panning;
+     * otherwise frames run as fast as events arrive. */
     game.hasquit = SDL_FALSE;
     while(game.hasquit == SDL_FALSE) {
         SDL_Event event;
-        while (SDL_PollEvent(&event)) {
-            switch (event.type) {
-            case SDL_MOUSEBUTTONDOWN:
-                game.current.pos.x = (event.motion.x / CELLSIZE) * CELLSIZE;
-                game.current.pos.y = (event.motion.y / CELLSIZE) * CELLSIZE;
-                /* Check for flagging/unflagging a cell */
-                if (event.button.button == SDL_BUTTON_RIGHT) {
-                    mouse.rightclick = SDL_TRUE;
-                } else {
-                    mouse.rightclick = SDL_FALSE;
-                }
-                break;
-            case SDL_WINDOWEVENT:
-                if (event.window.event == SDL_WINDOWEVENT_ENTER && !mouse.hover)
-                    mouse.hover = SDL_TRUE;
-                else if (event.window.event == SDL_WINDOWEVENT_LEAVE && mouse.hover)
-                    mouse.hover = SDL_FALSE;
-                break;
-            case SDL_QUIT:
-                game.hasquit = SDL_TRUE;
-                break;
-            }
+        int timeout = next_wake(&game);
+        int pending;
+        perf_stage(game.perf, PERF_IDLE);
+        if (timeout < 0) {
+            pending = SDL_WaitEvent(&event);
+        } else if (timeout > 0) {
+            pending = SDL_WaitEventTimeout(&event, timeout);
+        } else {
+            pending = SDL_PollEvent(&event);
+        }
+        perf_stage(game.perf, PERF_EVENTS);
+        while (pending) {
+            perf_stage(game.perf, PERF_LOGIC);
+            handle_event(&game, &mouse, &event);
+            perf_stage(game.perf, PERF_EVENTS);
+            pending = SDL_PollEvent(&event);
+        }
+        update_hud(&game);
+
+        /* Draw the cells that changed */
+        perf_stage(game.perf, PERF_DRAW);
+        draw_cells(&game);
+
+        /* Only present when there is something new to show. A frame in
+         * the timings runs from one present to the next. */
+        if (game.present) {
+            perf_stage(game.perf, PERF_PRESENT);
+            SDL_RenderCopy(game.render, game.target, NULL, NULL);
+            perf_count(game.perf, 1, 0);
+            draw_hint(&game);
+            draw_hud(&game);
+            SDL_RenderPresent(game.render);
+            perf_presented(game.perf);
+            game.present = SDL_FALSE;
+            perf_frame(game.perf);
         }
-        clear_zeros(&game);
-        /* Draw all cells */
-        draw_cells(&game, &mouse);
-
-        SDL_RenderPresent(game.render);
-        SDL_Delay(1000/24);
     }
 
+    SDL_DestroyTexture(game.target);
+    SDL_DestroyTexture(game.atlas);
     SDL_DestroyRenderer(game.render);
     SDL_DestroyWindow(game.window);
     SDL_Quit();
 
+    if (game.recorder && !replay_finish(game.recorder)) {
+        printf("Error writing replay %s\n", record);
+    }
+    if (game.savepath && !board_save(game.board, game.savepath)) {
+        printf("Error saving %s\n", game.savepath);
+    }
+    if (game.perfpath && !perf_dump(game.perf, game.perfpath)) {
+        printf("Error writing timings %s\n", game.perfpath);
+    }
+    perf_free(game.perf);
+    solver_free(game.solver);
+    prob_free(game.prob);
+    board_free(game.board);
+    free(game.dirty);
+    free(game.batch.verts);
+    free(game.batch.indices);
+    free(game.overlay.verts);
+    free(game.overlay.indices);
     return EXIT_SUCCESS;
 }
 
+int
+parse_args(int argc, char** argv, board_params_t* params, const char** record, const char** save,
+           const char** perf, SDL_bool* vsync, const char** sprites) {
+    params->width = DEFAULT_WIDTH;
+    params->height = DEFAULT_HEIGHT;
+    params->nummines = DEFAULT_MINES;
+    params->seed = (uint64_t)time(NULL);
+    params->infinite = false;
+    params->density = DEFAULT_DENSITY;
+    params->noguess = false;
+    params->threads = SDL_GetCPUCount();
+    for (int i=1; i<argc; i++) {
+        int* opt;
+        if (strcmp(argv[i], "-i") == 0) {
+            params->infinite = true;
+            continue;
+        } else if (strcmp(argv[i], "-v") == 0) {
+            *vsync = SDL_TRUE;
+            continue;
+        } else if (strcmp(argv[i], "-g") == 0) {
+            params->noguess = true;
+            continue;
+        } else if (strcmp(argv[i], "-r") == 0 && i+1 < argc) {
+            *record = argv[++i];
+            continue;
+        } else if (strcmp(argv[i], "-f") == 0 && i+1 < argc) {
+            *save = argv[++i];
+            continue;
+        } else if (strcmp(argv[i], "-p") == 0 && i+1 < argc) {
+            *perf = argv[++i];
+            continue;
+        } else if (strcmp(argv[i], "-t") == 0 && i+1 < argc) {
+            *sprites = argv[++i];
+            continue;
+        } else if (strcmp(argv[i], "-s") == 0 && i+1 < argc) {
+            char* end;
+            params->seed = strtoull(argv[++i], &end, 10);
+            if (*end != '\0') {
+                return 1;
+            }
+            continue;
+        } else if (strcmp(argv[i], "-w") == 0) {
+            opt = &params->width;
+        } else if (strcmp(argv[i], "-h") == 0) {
+            opt = &params->height;
+        } else if (strcmp(argv[i], "-m") == 0) {
+            opt = &params->nummines;
+        } else if (strcmp(argv[i], "-d") == 0) {
+            opt = &params->density;
+        } else {
+            return 1;
+        }
+        if (i+1 >= argc) {
+            return 1;
+        }
+        char* end;
+        long val = strtol(argv[++i], &end, 10);
+        if (*end != '\0' || val < 0 || val > INT_MAX) {
+            return 1;
+        }
+        *opt = (int)val;
+    }
+    if (params->infinite) {
+        /* Save files hold fixed boards only */
+        return *save != NULL || params->density < MIN_DENSITY || params->density > 100;
+    }
+    /* Leave at least one safe cell on the board */
+    if (params->width < 1 || params->height < 1 ||
+        (long long)params->nummines >= (long long)params->width * params->height) {
+        return 1;
+    }
+    return 0;
+}
+
+void
+load_surfaces(game_t* game, const char* dir) {
+    /* The sprites are compiled in, pre-decoded by tools/mkatlas, so by
+     * default nothing is loaded. With -t the PNGs in dir replace them,
+     * provided every one loads. */
+    static const char* files[NUM_SPRITES] = {
+        [SPRITE_ZERO] = "clicked_square.png",
+        [SPRITE_ONE] = "one.png",
+        [SPRITE_TWO] = "two.png",
+        [SPRITE_THREE] = "three.png",
+        [SPRITE_FOUR] = "four.png",
+        [SPRITE_FIVE] = "five.png",
+        [SPRITE_SIX] = "six.png",
+        [SPRITE_SEVEN] = "seven.png",
+        [SPRITE_EIGHT] = "eight.png",
+        [SPRITE_DEF] = "base_square_small.png",
+        [SPRITE_FLAG] = "flag.png",
+        [SPRITE_MINE] = "mine.png",
+        [SPRITE_HITMINE] = "hitmine.png",
+    };
+    if (!dir) {
+        return;
+    }
+    /* Copy every sprite into its slot of the atlas */
+    game->atlassurface = SDL_CreateRGBSurfaceWithFormat(0, NUM_SPRITES*CELLSIZE, CELLSIZE,
+                                                        32, SDL_PIXELFORMAT_RGBA32);
+    if (!game->atlassurface) {
+        printf("Error atlas init: %s, using the built in sprites\n", SDL_GetError());
+        return;
+    }
+    for (int i=0; i<NUM_SPRITES; i++) {
+        char path[4096];
+        snprintf(path, sizeof(path), "%s/%s", dir, files[i]);
+        SDL_Surface* sprite = IMG_Load(path);
+        if (!sprite || sprite->w != CELLSIZE || sprite->h != CELLSIZE) {
+            printf("Error loading %s: %s, using the built in sprites\n", path,
+                   sprite ? "wrong size" : IMG_GetError());
+            SDL_FreeSurface(sprite);
+            SDL_FreeSurface(game->atlassurface);
+            game->atlassurface = NULL;
+            return;
+        }
+        SDL_Rect slot = {i*CELLSIZE, 0, CELLSIZE, CELLSIZE};
+        SDL_SetSurfaceBlendMode(sprite, SDL_BLENDMODE_NONE);
+        SDL_BlitSurface(sprite, NULL, game->atlassurface, &slot);
+        SDL_FreeSurface(sprite);
+    }
+}
+
+void
+init_tx(game_t* game) {
+    /* One texture, filled in one upload from the -t sprites if they
+     * loaded, otherwise straight from the embedded pixels */
+    const void* pixels = atlas_pixels;
+    int pitch = ATLAS_WIDTH*4;
+    assert(ATLAS_WIDTH == NUM_SPRITES*CELLSIZE && ATLAS_HEIGHT == CELLSIZE);
+    if (game->atlassurface) {
+        pixels = game->atlassurface->pixels;
+        pitch = game->atlassurface->pitch;
+    }
+    game->atlas = SDL_CreateTexture(game->render, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC,
+                                    ATLAS_WIDTH, ATLAS_HEIGHT);
+    if (!game->atlas || SDL_UpdateTexture(game->atlas, NULL, pixels, pitch)) {
+        printf("Error atlas upload: %s\n", SDL_GetError());
+        exit(EXIT_FAILURE);
+    }
+    /* Redrawn cells must replace what was under them, not blend with it */
+    SDL_SetTextureBlendMode(game->atlas, SDL_BLENDMODE_NONE);
+    SDL_FreeSurface(game->atlassurface);
+    game->atlassurface = NULL;
+
+    /* Map every packed cell value straight to its sprite */
+    for (int c=0; c<CELL_STATES; c++) {
+        if (c & CELL_FLAG) {
+            game->sprites[c] = SPRITE_FLAG;
+        } else if (!(c & CELL_REVEALED)) {
+            game->sprites[c] = SPRITE_DEF;
+        } else if (c & CELL_MINE) {
+            game->sprites[c] = SPRITE_HITMINE;
+        } else {
+            game->sprites[c] = (c & CELL_COUNT) <= 8 ? (c & CELL_COUNT) : SPRITE_DEF;
+        }
+    }
+}
+
 void
-load_surfaces(game_t* game) {
-    game->surfaces.def = IMG_Load("resources/pngs/base_square_small.png");
-    game->surfaces.zero = IMG_Load("resources/pngs/clicked_square.png");
-    game->surfaces.mine = IMG_Load("resources/pngs/mine.png");
-    game->surfaces.hitmine = IMG_Load("resources/pngs/hitmine.png");
-    game->surfaces.flag = IMG_Load("resources/pngs/flag.png");
-    game->surfaces.one = IMG_Load("resources/pngs/one.png");
-    game->surfaces.two = IMG_Load("resources/pngs/two.png");
-    game->surfaces.three = IMG_Load("resources/pngs/three.png");
-    game->surfaces.four = IMG_Load("resources/pngs/four.png");
-    game->surfaces.five = IMG_Load("resources/pngs/five.png");
-    game->surfaces.six = IMG_Load("resources/pngs/six.png");
-    game->surfaces.seven = IMG_Load("resources/pngs/seven.png");
-    game->surfaces.eight = IMG_Load("resources/pngs/eight.png");
+batch_quad(batch_t* batch, float x, float y, float size, int sprite, SDL_Color color) {
+    if (batch->numquads == batch->capquads) {
+        int newcap = batch->capquads ? batch->capquads * 2 : 1024;
+        SDL_Vertex* verts = realloc(batch->verts, (size_t)newcap * 4 * sizeof(SDL_Vertex));
+        int* indices = realloc(batch->indices, (size_t)newcap * 6 * sizeof(int));
+        if (!verts || !indices) {
+            printf("Error growing draw batch to %d quads\n", newcap);
+            exit(EXIT_FAILURE);
+        }
+        /* Quads never share corners, so the index pattern is fixed */
+        for (int q=batch->capquads; q<newcap; q++) {
+            int* idx = &indices[q*6];
+            idx[0] = q*4;
+            idx[1] = q*4 + 1;
+            idx[2] = q*4 + 2;
+            idx[3] = q*4 + 2;
+            idx[4] = q*4 + 1;
+            idx[5] = q*4 + 3;
+        }
+        batch->verts = verts;
+        batch->indices = indices;
+        batch->capquads = newcap;
+    }
+    float u0 = (float)sprite / NUM_SPRITES;
+    float u1 = (float)(sprite + 1) / NUM_SPRITES;
+    SDL_Vertex* v = &batch->verts[batch->numquads*4];
+    v[0] = (SDL_Vertex){{x, y}, color, {u0, 0.0f}};
+    v[1] = (SDL_Vertex){{x + size, y}, color, {u1, 0.0f}};
+    v[2] = (SDL_Vertex){{x, y + size}, color, {u0, 1.0f}};
+    v[3] = (SDL_Vertex){{x + size, y + size}, color, {u1, 1.0f}};
+    batch->numquads++;
+}
 
+int
+batch_flush(SDL_Renderer* render, SDL_Texture* atlas, batch_t* batch) {
+    /* Returns the number of draw calls made, for the frame timings */
+    int calls = 0;
+    if (batch->numquads > 0) {
+        SDL_RenderGeometry(render, atlas, batch->verts, batch->numquads*4,
+                           batch->indices, batch->numquads*6);
+        calls = 1;
+    }
+    batch->numquads = 0;
+    return calls;
+}
+
+int
+create_target(game_t* game) {
+    /* (Re)creates the target texture to match the window */
+    SDL_GetWindowSize(game->window, &game->winw, &game->winh);
+    if (game->target) {
+        SDL_DestroyTexture(game->target);
+    }
+    game->target = SDL_CreateTexture(game->render, SDL_PIXELFORMAT_ARGB8888,
+                                     SDL_TEXTUREACCESS_TARGET, game->winw, game->winh);
+    game->redraw = SDL_TRUE;
+    return game->target == NULL;
 }
 
 void
-generate_mines(game_t* game) {
-    int x,y;
-    for (int i=0; i<NUM_MINES; i++) {
-        y = (rand() % GRID_HEIGHT);      // Returns a pseudo-random integer between 0 and GH-1
-        x = (rand() % GRID_WIDTH);    
-        game->board[y][x].state.ismine = SDL_TRUE;
-        printf("Mine at (%d, %d)\n", x,y);
+screen_to_cell(game_t* game, int sx, int sy, coord_t* cell) {
+    /* Undo the camera transform, O(1) whatever the board size */
+    double wx = game->camera.x + sx / game->camera.zoom;
+    double wy = game->camera.y + sy / game->camera.zoom;
+    cell->x = (int)SDL_floor(wx / CELLSIZE);
+    cell->y = (int)SDL_floor(wy / CELLSIZE);
+}
+
+void
+visible_cells(game_t* game, coord_t* first, coord_t* last) {
+    /* Cells intersecting the window, clamped to the board. Empty (last
+     * before first) when the camera looks past the board's edge. */
+    camera_t* cam = &game->camera;
+    screen_to_cell(game, 0, 0, first);
+    last->x = (int)SDL_ceil((cam->x + game->winw / cam->zoom) / CELLSIZE) - 1;
+    last->y = (int)SDL_ceil((cam->y + game->winh / cam->zoom) / CELLSIZE) - 1;
+    const board_params_t* params = board_params(game->board);
+    if (params->infinite) {
+        return;
     }
+    first->x = SDL_max(first->x, 0);
+    first->y = SDL_max(first->y, 0);
+    last->x = SDL_min(last->x, params->width - 1);
+    last->y = SDL_min(last->y, params->height - 1);
 }
 
 void
-init_cell_details(game_t* game) {
-    /* Loop through all cells */
-    for (int i=0; i<GRID_HEIGHT; i++) {
-        for (int j=0;j<GRID_WIDTH; j++) {
-            game->board[i][j].pos.y = i*CELLSIZE;
-            game->board[i][j].pos.x = j*CELLSIZE;
-            game->board[i][j].pos.w = CELLSIZE;
-            game->board[i][j].pos.h = CELLSIZE;
-            game->board[i][j].state.clicked = SDL_FALSE;
-            game->board[i][j].state.isflag = SDL_FALSE;
-            game->board[i][j].state.numtouching = 0;
-            if (game->board[i][j].state.ismine != SDL_TRUE) {
-                game->board[i][j].state.ismine = SDL_FALSE;
-            }
+camera_pan(game_t* game, double dx, double dy) {
+    /* Moves the view by (dx,dy) screen px, keeping at least half a window
+     * of board in view */
+    camera_t* cam = &game->camera;
+    double vieww = game->winw / cam->zoom;
+    double viewh = game->winh / cam->zoom;
+    const board_params_t* params = board_params(game->board);
+    double minx = -vieww/2, maxx = (double)params->width*CELLSIZE - vieww/2;
+    double miny = -viewh/2, maxy = (double)params->height*CELLSIZE - viewh/2;
+    if (params->infinite) {
+        minx = miny = -(double)CHUNK_LIMIT*CELLSIZE;
+        maxx = (double)CHUNK_LIMIT*CELLSIZE - vieww;
+        maxy = (double)CHUNK_LIMIT*CELLSIZE - viewh;
+    }
+    cam->x = SDL_clamp(cam->x + dx / cam->zoom, minx, maxx);
+    cam->y = SDL_clamp(cam->y + dy / cam->zoom, miny, maxy);
+    game->redraw = SDL_TRUE;
+}
+
+void
+camera_zoom(game_t* game, double factor, int sx, int sy) {
+    /* Zooms about screen point (sx,sy) so the board px under it stays put */
+    camera_t* cam = &game->camera;
+    double zoom = SDL_clamp(cam->zoom * factor, MIN_ZOOM, MAX_ZOOM);
+    cam->x += sx / cam->zoom - sx / zoom;
+    cam->y += sy / cam->zoom - sy / zoom;
+    cam->zoom = zoom;
+    camera_pan(game, 0, 0);
+}
+
+void
+handle_event(game_t* game, mouse_t* mouse, SDL_Event* event) {
+    switch (event->type) {
+    case SDL_MOUSEBUTTONDOWN: {
+        /* The middle button pans instead of clicking */
+        if (event->button.button == SDL_BUTTON_MIDDLE) {
+            break;
+        }
+        size_t numdirty = game->numdirty;
+        screen_to_cell(game, event->button.x, event->button.y, &game->current);
+        /* Check for flagging/unflagging a cell */
+        handle_click(game, event->button.button == SDL_BUTTON_RIGHT);
+        /* Time it until the frame showing its changes is presented */
+        if (game->numdirty > numdirty) {
+            perf_input(game->perf, event->button.timestamp);
+        }
+        break;
+    }
+    case SDL_MOUSEMOTION:
+        if (event->motion.state & SDL_BUTTON_MMASK) {
+            camera_pan(game, -event->motion.xrel, -event->motion.yrel);
+        }
+        break;
+    case SDL_MOUSEWHEEL: {
+        int mx, my;
+        int notches = event->wheel.y;
+        if (event->wheel.direction == SDL_MOUSEWHEEL_FLIPPED) {
+            notches = -notches;
         }
+        SDL_GetMouseState(&mx, &my);
+        camera_zoom(game, SDL_pow(ZOOM_STEP, notches), mx, my);
+        break;
+    }
+    case SDL_KEYDOWN:
+        handle_key(game, event->key.keysym.sym);
+        break;
+    case SDL_WINDOWEVENT:
+        if (event->window.event == SDL_WINDOWEVENT_ENTER && !mouse->hover)
+            mouse->hover = SDL_TRUE;
+        else if (event->window.event == SDL_WINDOWEVENT_LEAVE && mouse->hover)
+            mouse->hover = SDL_FALSE;
+        else if (event->window.event == SDL_WINDOWEVENT_EXPOSED)
+            game->present = SDL_TRUE;
+        else if (event->window.event == SDL_WINDOWEVENT_SIZE_CHANGED && create_target(game))
+            printf("Error target resize: %s\n", SDL_GetError());
+        break;
+    case SDL_RENDER_TARGETS_RESET:
+        /* The target texture's contents are gone */
+        game->redraw = SDL_TRUE;
+        break;
+    case SDL_QUIT:
+        game->hasquit = SDL_TRUE;
+        break;
+    }
+}
+
+int
+next_wake(game_t* game) {
+    /* ms the loop may sleep before it has work of its own: 0 when a frame
+     * is waiting to be drawn, -1 to sleep until the next event */
+    if (game->redraw || game->numdirty > 0 || game->present) {
+        return 0;
+    }
+    if (game->showhud) {
+        Uint32 since = SDL_GetTicks() - game->hudticks;
+        return since >= HUD_REFRESH ? 0 : (int)(HUD_REFRESH - since);
     }
-    generate_touching_details(game);
+    return -1;
 }
 
 void
-generate_touching_details(game_t* game) {
-    /* Needs to check all 8 positions around each mine */
-    /* Loop through all cells */
-    for (int y=0; y<GRID_HEIGHT; y++) {
-        for (int x=0;x<GRID_WIDTH; x++) {
-            /* Check all cells around this one */
-            /* Check cell above */
-            if (y>0) {
-                if (game->board[x][y-1].state.ismine == SDL_TRUE) {
-                    game->board[x][y].state.numtouching++;
-                }
-            }
-            /* Check cell below */
-            if (y<GRID_HEIGHT-1) {
-                if (game->board[x][y+1].state.ismine == SDL_TRUE) {
-                    game->board[x][y].state.numtouching++;
-                }
-            }
+handle_key(game_t* game, SDL_Keycode key) {
+    switch (key) {
+    case SDLK_LEFT:
+    case SDLK_a:
+        camera_pan(game, -PAN_STEP, 0);
+        break;
+    case SDLK_RIGHT:
+    case SDLK_d:
+        camera_pan(game, PAN_STEP, 0);
+        break;
+    case SDLK_UP:
+    case SDLK_w:
+        camera_pan(game, 0, -PAN_STEP);
+        break;
+    case SDLK_DOWN:
+    case SDLK_s:
+        camera_pan(game, 0, PAN_STEP);
+        break;
+    case SDLK_PLUS:
+    case SDLK_EQUALS:
+    case SDLK_KP_PLUS:
+        camera_zoom(game, ZOOM_STEP, game->winw/2, game->winh/2);
+        break;
+    case SDLK_MINUS:
+    case SDLK_KP_MINUS:
+        camera_zoom(game, 1/ZOOM_STEP, game->winw/2, game->winh/2);
+        break;
+    case SDLK_HOME:
+        /* Back to the top left corner at 1:1 */
+        game->camera = (camera_t){0.0, 0.0, 1.0};
+        game->redraw = SDL_TRUE;
+        break;
+    case SDLK_h:
+        show_hint(game);
+        break;
+    case SDLK_f:
+        auto_flag(game);
+        break;
+    case SDLK_p:
+        if (!start_helpers(game)) {
+            break;
+        }
+        game->heatmap = !game->heatmap;
+        update_heatmap(game);
+        game->redraw = SDL_TRUE;
+        break;
+    case SDLK_F3:
+        game->showhud = !game->showhud;
+        game->hudticks = 0;
+        game->present = SDL_TRUE;
+        break;
+    case SDLK_F5:
+        if (!game->savepath) {
+            printf("No board file, start with -f to save\n");
+        } else if (!board_save(game->board, game->savepath)) {
+            printf("Error saving %s\n", game->savepath);
+        } else {
+            printf("Saved %s\n", game->savepath);
+        }
+        break;
+    }
+}
 
-            /* Check cell to the left */
-            if (x>0) {
-                if (game->board[x-1][y].state.ismine == SDL_TRUE) {
-                    game->board[x][y].state.numtouching++;
-                }
-            }
+void
+handle_click(game_t* game, SDL_bool rightclick) {
+    int x = game->current.x;
+    int y = game->current.y;
+    cell_t cell = board_peek(game->board, x, y);
+    const coord_t* changed;
+    size_t numchanged;
+
+    if (rightclick) {
+        /* Flag/unflag a hidden cell */
+        board_flag(game->board, x, y);
+        record_move(game, REPLAY_FLAG, x, y);
+    } else if (cell & CELL_REVEALED) {
+        /* Clicking a satisfied number opens the rest around it */
+        board_chord(game->board, x, y);
+        record_move(game, REPLAY_CHORD, x, y);
+    } else {
+        /* Reveal the cell and any empty region behind it */
+        board_reveal(game->board, x, y);
+        record_move(game, REPLAY_REVEAL, x, y);
+    }
+    changed = board_changes(game->board, &numchanged);
+    push_dirty(game, changed, numchanged);
+    if (game->solver) {
+        solver_update(game->solver, changed, numchanged);
+    }
+    if (game->showhint) {
+        game->showhint = SDL_FALSE;
+        game->present = SDL_TRUE;
+    }
+    /* Any move can shift every probability */
+    if (game->heatmap) {
+        update_heatmap(game);
+        game->redraw = SDL_TRUE;
+    }
+}
 
-            /* Check cell to the right */
-            if (x<GRID_WIDTH-1) {
-                if (game->board[x+1][y].state.ismine == SDL_TRUE) {
-                    game->board[x][y].state.numtouching++;
-                }
-            }
+void
+record_move(game_t* game, replay_action_t action, int x, int y) {
+    /* Buffered, so a move costs a few bytes of encoding */
+    if (game->recorder) {
+        replay_record(game->recorder, game->board, action, x, y, SDL_GetTicks() - game->recordstart);
+    }
+}
 
-            /* Check left upper diagonal cell */
-            if (x>0 && y>0) {
-                if (game->board[x-1][y-1].state.ismine == SDL_TRUE) {
-                    game->board[x][y].state.numtouching++;
-                }
+SDL_bool
+start_helpers(game_t* game) {
+    /* The solver and probability engine are made on first use, so opening
+     * a huge saved board never pays for them. The solver then catches up
+     * on the cells revealed so far in one pass. */
+    const board_params_t* params = board_params(game->board);
+    if (params->infinite) {
+        printf("No solver on infinite boards\n");
+        return SDL_FALSE;
+    }
+    if (game->solver) {
+        return SDL_TRUE;
+    }
+    game->solver = solver_new(game->board);
+    game->prob = prob_new(game->board, SDL_GetCPUCount());
+    if (!game->solver || !game->prob) {
+        printf("Error allocating the solver\n");
+        exit(EXIT_FAILURE);
+    }
+    coord_t revealed[1024];
+    size_t num = 0;
+    for (int y=0; y<params->height; y++) {
+        for (int x=0; x<params->width; x++) {
+            if (board_peek(game->board, x, y) & CELL_REVEALED) {
+                revealed[num++] = (coord_t){x, y};
             }
-
-            /* Check right upper diagonal cell */
-            if (x<GRID_WIDTH-1 && y>0) {
-                if (game->board[x+1][y-1].state.ismine == SDL_TRUE) {
-                    game->board[x][y].state.numtouching++;
-                }
+            if (num == SDL_arraysize(revealed)) {
+                solver_update(game->solver, revealed, num);
+                num = 0;
             }
+        }
+    }
+    solver_update(game->solver, revealed, num);
+    return SDL_TRUE;
+}
 
-            /* Check left bottom diagonal cell */
-            if (x>0 && y<GRID_HEIGHT-1) {
-                if (game->board[x-1][y+1].state.ismine == SDL_TRUE) {
-                    game->board[x][y].state.numtouching++;
-                }
-            }
+void
+show_hint(game_t* game) {
+    /* Highlights a cell the solver has proven safe */
+    if (!start_helpers(game)) {
+        return;
+    }
+    if (solver_next_safe(game->solver, &game->hint)) {
+        printf("hint at (%d, %d)\n", game->hint.x, game->hint.y);
+    } else if (prob_compute(game->prob) && prob_best(game->prob, &game->hint)) {
+        /* Nothing is certain, point at the safest guess instead */
+        printf("no safe cell, best guess (%d, %d) is a mine with p=%.3f\n", game->hint.x,
+               game->hint.y, prob_mine(game->prob, game->hint.x, game->hint.y));
+    } else {
+        return;
+    }
+    game->showhint = SDL_TRUE;
+    game->present = SDL_TRUE;
+}
 
-            /* Check right bottom diagonal cell */
-            if (x<GRID_WIDTH-1 && y<GRID_HEIGHT-1) {
-                if (game->board[x+1][y+1].state.ismine == SDL_TRUE) {
-                    game->board[x][y].state.numtouching++;
-                }
-            }
+void
+auto_flag(game_t* game) {
+    /* Flags every cell the solver has proven to be a mine */
+    const coord_t* mines;
+    size_t nummines;
+
+    if (!start_helpers(game)) {
+        return;
+    }
+    mines = solver_mines(game->solver, &nummines);
+    for (size_t i=0; i<nummines; i++) {
+        cell_t cell = board_peek(game->board, mines[i].x, mines[i].y);
+        if (!(cell & (CELL_FLAG | CELL_REVEALED))) {
+            const coord_t* changed;
+            size_t numchanged;
+            board_flag(game->board, mines[i].x, mines[i].y);
+            record_move(game, REPLAY_FLAG, mines[i].x, mines[i].y);
+            changed = board_changes(game->board, &numchanged);
+            push_dirty(game, changed, numchanged);
         }
     }
 }
 
 void
-init_tx(game_t* game) {
-    game->textures.def = SDL_CreateTextureFromSurface(game->render, game->surfaces.def);
-    game->textures.zero = SDL_CreateTextureFromSurface(game->render, game->surfaces.zero);
-    game->textures.mine = SDL_CreateTextureFromSurface(game->render, game->surfaces.mine);
-    game->textures.hitmine = SDL_CreateTextureFromSurface(game->render, game->surfaces.hitmine);
-    game->textures.flag = SDL_CreateTextureFromSurface(game->render, game->surfaces.flag);
-    game->textures.one = SDL_CreateTextureFromSurface(game->render, game->surfaces.one);
-    game->textures.two = SDL_CreateTextureFromSurface(game->render, game->surfaces.two);
-    game->textures.three = SDL_CreateTextureFromSurface(game->render, game->surfaces.three);
-    game->textures.four = SDL_CreateTextureFromSurface(game->render, game->surfaces.four);
-    game->textures.five = SDL_CreateTextureFromSurface(game->render, game->surfaces.five);
-    game->textures.six = SDL_CreateTextureFromSurface(game->render, game->surfaces.six);
-    game->textures.seven = SDL_CreateTextureFromSurface(game->render, game->surfaces.seven);
-    game->textures.eight = SDL_CreateTextureFromSurface(game->render, game->surfaces.eight);
-
-    SDL_FreeSurface(game->surfaces.def);
-    SDL_FreeSurface(game->surfaces.zero);
-    SDL_FreeSurface(game->surfaces.mine);
-    SDL_FreeSurface(game->surfaces.hitmine);
-    SDL_FreeSurface(game->surfaces.flag);
-    SDL_FreeSurface(game->surfaces.one);
-    SDL_FreeSurface(game->surfaces.two);
-    SDL_FreeSurface(game->surfaces.three);
-    SDL_FreeSurface(game->surfaces.four);
-    SDL_FreeSurface(game->surfaces.five);
-    SDL_FreeSurface(game->surfaces.six);
-    SDL_FreeSurface(game->surfaces.seven);
-    SDL_FreeSurface(game->surfaces.eight);
+push_dirty(game_t* game, const coord_t* cells, size_t num) {
+    /* Queue cells to be drawn again on the next frame */
+    if (game->numdirty + num > game->capdirty) {
+        size_t newcap = SDL_max(game->capdirty * 2, game->numdirty + num);
+        coord_t* grown = realloc(game->dirty, newcap * sizeof(coord_t));
+        if (!grown) {
+            printf("Error growing dirty list to %zu cells\n", newcap);
+            exit(EXIT_FAILURE);
+        }
+        game->dirty = grown;
+        game->capdirty = newcap;
+    }
+    memcpy(&game->dirty[game->numdirty], cells, num * sizeof(coord_t));
+    game->numdirty += num;
 }
 
 void
-draw_cells(game_t* game, mouse_t* mouse) {
-    for (int i=0; i<GRID_HEIGHT; i++) {
-        for (int j=0; j<GRID_WIDTH; j++) {
-            /* Set if the cell has been clicked */
-            if (game->current.pos.x == game->board[i][j].pos.x && game->current.pos.y == game->board[i][j].pos.y) {
-                game->board[i][j].state.clicked = SDL_TRUE;
-                printf("click at (%d, %d)\n", j, i);
-                /* Check if this click was a flag/unflag */
-                if (mouse->rightclick == SDL_TRUE) {
-                    game->board[i][j].state.isflag = !game->board[i][j].state.isflag;
-                    mouse->rightclick = SDL_FALSE;
-                }
-            }
+draw_cell(game_t* game, int x, int y) {
+    camera_t* cam = &game->camera;
+    cell_t cell = board_peek(game->board, x, y);
+    float sx = (float)(((double)x*CELLSIZE - cam->x) * cam->zoom);
+    float sy = (float)(((double)y*CELLSIZE - cam->y) * cam->zoom);
+    float size = (float)(CELLSIZE * cam->zoom);
+    SDL_Color white = {255, 255, 255, 255};
+    batch_quad(&game->batch, sx, sy, size, game->sprites[cell & (CELL_STATES-1)], white);
+    if (game->heatmap) {
+        /* Green for safe through red for certain mines */
+        double p = prob_mine(game->prob, x, y);
+        if (p >= 0.0) {
+            SDL_Color heat = {(Uint8)(255*p), (Uint8)(255*(1-p)), 0, 128};
+            batch_quad(&game->overlay, sx, sy, size, 0, heat);
+        }
+    }
+}
+
+void
+update_heatmap(game_t* game) {
+    if (game->heatmap && !prob_compute(game->prob)) {
+        printf("Revealed numbers admit no mine layout\n");
+    }
+}
+
+void
+draw_hint(game_t* game) {
+    /* Drawn over the presented frame, not into the target, so hiding it
+     * needs no cell redraw */
+    camera_t* cam = &game->camera;
+    if (!game->showhint) {
+        return;
+    }
+    SDL_FRect rect = {(float)(((double)game->hint.x*CELLSIZE - cam->x) * cam->zoom),
+                      (float)(((double)game->hint.y*CELLSIZE - cam->y) * cam->zoom),
+                      (float)(CELLSIZE * cam->zoom), (float)(CELLSIZE * cam->zoom)};
+    SDL_SetRenderDrawBlendMode(game->render, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(game->render, 0, 255, 0, 96);
+    SDL_RenderFillRectF(game->render, &rect);
+    perf_count(game->perf, 1, 0);
+}
 
-            /* Cell hasnt been clicked */
-            if (game->board[i][j].state.clicked == SDL_FALSE) {
-                /* Thus render def view */
-                SDL_RenderCopy(game->render, game->textures.def, NULL, &game->board[i][j].pos);
-            /* Cell has been flagged */
-            } else if (game->board[i][j].state.isflag) {
-                SDL_RenderCopy(game->render, game->textures.flag, NULL, &game->board[i][j].pos);
-            /* Display a number */
-            } else if (game->board[i][j].state.ismine == SDL_FALSE) {
-                if (game->board[i][j].state.numtouching == 0) {
-                    SDL_RenderCopy(game->render, game->textures.zero, NULL, &game->board[i][j].pos);
-                } else if (game->board[i][j].state.numtouching == 1) {
-                    SDL_RenderCopy(game->render, game->textures.one, NULL, &game->board[i][j].pos);
-                } else if (game->board[i][j].state.numtouching == 2) {
-                    SDL_RenderCopy(game->render, game->textures.two, NULL, &game->board[i][j].pos);
-                } else if (game->board[i][j].state.numtouching == 3) {
-                    SDL_RenderCopy(game->render, game->textures.three, NULL, &game->board[i][j].pos);
-                } else if (game->board[i][j].state.numtouching == 4) {
-                    SDL_RenderCopy(game->render, game->textures.four, NULL, &game->board[i][j].pos);
-                } else if (game->board[i][j].state.numtouching == 5) {
-                    SDL_RenderCopy(game->render, game->textures.five, NULL, &game->board[i][j].pos);
-                } else if (game->board[i][j].state.numtouching == 6) {
-                    SDL_RenderCopy(game->render, game->textures.six, NULL, &game->board[i][j].pos);
-                } else if (game->board[i][j].state.numtouching == 7) {
-                    SDL_RenderCopy(game->render, game->textures.seven, NULL, &game->board[i][j].pos);
-                } else if (game->board[i][j].state.numtouching == 8) {
-                    SDL_RenderCopy(game->render, game->textures.eight, NULL, &game->board[i][j].pos);
-                }
-            /* Display the mine hit */
-            } else {
-                SDL_RenderCopy(game->render, game->textures.hitmine, NULL, &game->board[i][j].pos);
+void
+draw_cells(game_t* game) {
+    /* Draws into the persistent target: every visible cell after the target
+     * was lost or the camera moved, otherwise only the dirty cells. Only
+     * cells inside the viewport are ever queued, so frame cost scales with
+     * the window and the number of changes, never with the board area. */
+    coord_t first, last;
+
+    if (!game->redraw && game->numdirty == 0) {
+        return;
+    }
+    visible_cells(game, &first, &last);
+    SDL_SetRenderTarget(game->render, game->target);
+    if (game->redraw) {
+        SDL_SetRenderDrawColor(game->render, 0, 0, 0, 255);
+        SDL_RenderClear(game->render);
+        for (int i=first.y; i<=last.y; i++) {
+            for (int j=first.x; j<=last.x; j++) {
+                draw_cell(game, j, i);
+            }
+        }
+    } else {
+        for (size_t i=0; i<game->numdirty; i++) {
+            coord_t c = game->dirty[i];
+            if (c.x >= first.x && c.x <= last.x && c.y >= first.y && c.y <= last.y) {
+                draw_cell(game, c.x, c.y);
             }
         }
     }
+    /* Submit every queued cell in one call against the atlas, then the
+     * heatmap over them in one more */
+    int cells = game->batch.numquads;
+    int calls = game->redraw;   // the clear
+    calls += batch_flush(game->render, game->atlas, &game->batch);
+    SDL_SetRenderDrawBlendMode(game->render, SDL_BLENDMODE_BLEND);
+    calls += batch_flush(game->render, NULL, &game->overlay);
+    SDL_SetRenderTarget(game->render, NULL);
+    perf_count(game->perf, calls, cells);
+
+    game->redraw = SDL_FALSE;
+    game->numdirty = 0;
+    game->present = SDL_TRUE;
 }
 
 void
-clear_zeros(game_t* game) {
-    // if a zero is touching a clicked cell 0-8, click it.
-    // and if a 1-8cell is touching a clicked 0, click it.
-/* Needs to check all 8 positions around each mine */
-    /* Loop through all cells */
-    for (int y=0; y<GRID_HEIGHT; y++) {
-        for (int x=0;x<GRID_WIDTH; x++) {
-            if (game->board[x][y].state.numtouching == 0 && !game->board[x][y].state.ismine) {
-                /* Check all cells around this one */
-                /* Check cell above */
-                if (y>0) {
-                    if (game->board[x][y-1].state.clicked == SDL_TRUE) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
-                /* Check cell below */
-                if (y<GRID_HEIGHT-1) {
-                    if (game->board[x][y+1].state.clicked == SDL_TRUE) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
-
-                /* Check cell to the left */
-                if (x>0) {
-                    if (game->board[x-1][y].state.clicked == SDL_TRUE) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
-
-                /* Check cell to the right */
-                if (x<GRID_WIDTH-1) {
-                    if (game->board[x+1][y].state.clicked == SDL_TRUE) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
-
-                /* Check left upper diagonal cell */
-                if (x>0 && y>0) {
-                    if (game->board[x-1][y-1].state.clicked == SDL_TRUE) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
-
-                /* Check right upper diagonal cell */
-                if (x<GRID_WIDTH-1 && y>0) {
-                    if (game->board[x+1][y-1].state.clicked == SDL_TRUE) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
-
-                /* Check left bottom diagonal cell */
-                if (x>0 && y<GRID_HEIGHT-1) {
-                    if (game->board[x-1][y+1].state.clicked == SDL_TRUE) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
-
-                /* Check right bottom diagonal cell */
-                if (x<GRID_WIDTH-1 && y<GRID_HEIGHT-1) {
-                    if (game->board[x+1][y+1].state.clicked == SDL_TRUE) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
-            } else if (!game->board[x][y].state.ismine) {
-
-                /* MAKE SURE TO NOT CLICK MINES !!*/
-                 // and if a 1-8cell is touching a clicked 0, click it.
-                 /* Check all cells around this one */
-                /* Check cell above */
-                if (y>0) {
-                    if ((game->board[x][y-1].state.clicked == SDL_TRUE) && (game->board[x][y-1].state.numtouching == 0) && !game->board[x][y-1].state.ismine) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
-                /* Check cell below */
-                if (y<GRID_HEIGHT-1) {
-                    if ((game->board[x][y+1].state.clicked == SDL_TRUE) && (game->board[x][y+1].state.numtouching == 0)&& !game->board[x][y+1].state.ismine) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
-
-                /* Check cell to the left */
-                if (x>0) {
-                    if ((game->board[x-1][y].state.clicked == SDL_TRUE) && (game->board[x-1][y].state.numtouching == 0)&& !game->board[x-1][y].state.ismine) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
-
-                /* Check cell to the right */
-                if (x<GRID_WIDTH-1) {
-                    if ((game->board[x+1][y].state.clicked == SDL_TRUE) && (game->board[x+1][y].state.numtouching == 0)&& !game->board[x+1][y].state.ismine) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
-
-                /* Check left upper diagonal cell */
-                if (x>0 && y>0) {
-                    if ((game->board[x-1][y-1].state.clicked == SDL_TRUE) && (game->board[x-1][y-1].state.numtouching == 0)&& !game->board[x-1][y-1].state.ismine) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
-
-                /* Check right upper diagonal cell */
-                if (x<GRID_WIDTH-1 && y>0) {
-                    if ((game->board[x+1][y-1].state.clicked == SDL_TRUE) && (game->board[x+1][y-1].state.numtouching == 0)&& (!game->board[x+1][y-1].state.ismine)) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
-
-                /* Check left bottom diagonal cell */
-                if (x>0 && y<GRID_HEIGHT-1) {
-                    if ((game->board[x-1][y+1].state.clicked == SDL_TRUE) && game->board[x-1][y+1].state.numtouching == 0 && !game->board[x-1][y+1].state.ismine) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
-
-                /* Check right bottom diagonal cell */
-                if (x<GRID_WIDTH-1 && y<GRID_HEIGHT-1) {
-                    if ((game->board[x+1][y+1].state.clicked == SDL_TRUE) && (game->board[x+1][y+1].state.numtouching == 0)&& !game->board[x+1][y+1].state.ismine) {
-                        game->board[x][y].state.clicked = SDL_TRUE;
-                    }
-                }
+update_hud(game_t* game) {
+    /* Refreshes the HUD text a few times a second; sorting for the
+     * percentiles every frame would show up in the timings themselves */
+    perf_stats_t st;
+    Uint32 now = SDL_GetTicks();
+    if (!game->showhud || (game->hudticks && now - game->hudticks < HUD_REFRESH)) {
+        return;
+    }
+    game->hudticks = now ? now : 1;
+    perf_stats(game->perf, &st);
+    /* The loop sleeps in SDL_WaitEvent, so frame time is mostly the wait
+     * for the next input; busy time is the cost of a frame */
+    snprintf(game->hud[0], sizeof(game->hud[0]), "FPS %.1f  BUSY P50 %.2f P99 %.2f MS",
+             st.fps, st.busy50, st.busy99);
+    snprintf(game->hud[1], sizeof(game->hud[1]), "FRAME INCL IDLE P50 %.2f P99 %.2f MS", st.frame50, st.frame99);
+    snprintf(game->hud[2], sizeof(game->hud[2]), "CLICK TO PRESENT P50 %.1f P99 %.1f MS",
+             st.latency50, st.latency99);
+    snprintf(game->hud[3], sizeof(game->hud[3]), "DRAW CALLS %d  CELLS %d", st.drawcalls, st.cells);
+    snprintf(game->hud[4], sizeof(game->hud[4]), "EVENTS %.2f LOGIC %.2f DRAW %.2f PRESENT %.2f",
+             st.stage[PERF_EVENTS], st.stage[PERF_LOGIC], st.stage[PERF_DRAW], st.stage[PERF_PRESENT]);
+    game->present = SDL_TRUE;
+}
+
+void
+draw_text(game_t* game, float x, float y, const char* text) {
+    /* A 3x5 pixel font, one square quad per lit pixel, so the HUD needs no
+     * font file. Each glyph is 15 bits, rows top to bottom, left bit first.
+     * Characters without a glyph are left blank. */
+    static const uint16_t digits[10] = {
+        0x7B6F, 0x2C97, 0x73E7, 0x72CF, 0x5BC9, 0x79CF, 0x79EF, 0x7292, 0x7BEF, 0x7BCF
+    };
+    static const uint16_t letters[26] = {
+        0x2BED, 0x6BAE, 0x3923, 0x6B6E, 0x79A7, 0x79A4, 0x396B, 0x5BED, 0x7497, 0x126A,
+        0x5BAD, 0x4927, 0x5FED, 0x6B6D, 0x2B6A, 0x6BA4, 0x2B73, 0x6BAD, 0x388E, 0x7492,
+        0x5B6F, 0x5B6A, 0x5BFD, 0x5AAD, 0x5A92, 0x72A7
+    };
+    SDL_Color white = {255, 255, 255, 255};
+    for (; *text; text++, x += 4*HUD_PIXEL) {
+        uint16_t glyph = 0;
+        if (*text >= '0' && *text <= '9') {
+            glyph = digits[*text - '0'];
+        } else if (*text >= 'A' && *text <= 'Z') {
+            glyph = letters[*text - 'A'];
+        } else if (*text == '.') {
+            glyph = 0x0002;
+        } else if (*text == '-') {
+            glyph = 0x01C0;
+        }
+        for (int bit=0; bit<15; bit++) {
+            if (glyph & (0x4000 >> bit)) {
+                batch_quad(&game->overlay, x + (bit % 3)*HUD_PIXEL, y + (bit / 3)*HUD_PIXEL,
+                           HUD_PIXEL, 0, white);
             }
         }
     }
-}
\ No newline at end of file
+}
+
+void
+draw_hud(game_t* game) {
+    /* Like the hint, drawn over the presented frame only */
+    if (!game->showhud) {
+        return;
+    }
+    size_t width = 0;
+    for (int i=0; i<HUD_LINES; i++) {
+        width = SDL_max(width, strlen(game->hud[i]));
+    }
+    SDL_FRect panel = {0, 0, (float)((width*4 + 3) * HUD_PIXEL), (float)((HUD_LINES*7 + 1) * HUD_PIXEL)};
+    SDL_SetRenderDrawBlendMode(game->render, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(game->render, 0, 0, 0, 176);
+    SDL_RenderFillRectF(game->render, &panel);
+    for (int i=0; i<HUD_LINES; i++) {
+        draw_text(game, 2*HUD_PIXEL, (float)((i*7 + 2) * HUD_PIXEL), game->hud[i]);
+    }
+    perf_count(game->perf, 1 + batch_flush(game->render, NULL, &game->overlay), 0);
+}
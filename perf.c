@@ -0,0 +1,267 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "perf.h"
+
+/*============================================================================*/
+
+#define MAX_PENDING (64)    // clicks waiting for a present; more are not timed
+
+/* The ring has one writer, the main loop. It fills the slot after the
+ * newest and then publishes it by bumping the count with a release store,
+ * so a reader that loads the count with acquire sees whole frames. */
+struct perf {
+    Uint64 freq;        // counter ticks per second
+    Uint64 origin;      // counter at perf_new
+    Uint64 mark;        // counter at the last stage switch
+    perf_stage_t stage;
+    perf_frame_t current;
+    perf_frame_t frames[PERF_FRAMES];
+    Uint64 numframes;   // frames ever published
+    float latency[PERF_INPUTS];
+    Uint64 numinputs;   // latencies ever published
+    Uint64 pending[MAX_PENDING];    // counter at each unpresented click
+    int numpending;
+};
+
+static const char* stage_names[PERF_NUM_STAGES] = {
+    [PERF_EVENTS] = "events",
+    [PERF_LOGIC] = "logic",
+    [PERF_DRAW] = "draw",
+    [PERF_PRESENT] = "present",
+    [PERF_IDLE] = "idle",
+};
+
+/*============================================================================*/
+static double ms_between(const perf_t* perf, Uint64 from, Uint64 to);
+static size_t copy_latencies(const perf_t* perf, float* out, size_t max);
+static int cmp_float(const void* a, const void* b);
+static float percentile(float* values, size_t num, double p);
+/*================================================*/
+
+perf_t*
+perf_new(void) {
+    perf_t* perf = calloc(1, sizeof(perf_t));
+    if (!perf) {
+        return NULL;
+    }
+    perf->freq = SDL_GetPerformanceFrequency();
+    perf->origin = perf->mark = SDL_GetPerformanceCounter();
+    perf->stage = PERF_EVENTS;
+    return perf;
+}
+
+void
+perf_free(perf_t* perf) {
+    free(perf);
+}
+
+void
+perf_stage(perf_t* perf, perf_stage_t stage) {
+    Uint64 now = SDL_GetPerformanceCounter();
+    perf->current.stage[perf->stage] += (float)ms_between(perf, perf->mark, now);
+    perf->mark = now;
+    perf->stage = stage;
+}
+
+void
+perf_count(perf_t* perf, int drawcalls, int cells) {
+    perf->current.drawcalls += drawcalls;
+    perf->current.cells += cells;
+}
+
+void
+perf_frame(perf_t* perf) {
+    perf_stage(perf, PERF_EVENTS);
+    perf_frame_t* frame = &perf->current;
+    for (int s=0; s<PERF_NUM_STAGES; s++) {
+        frame->frame += frame->stage[s];
+    }
+    Uint64 head = perf->numframes;
+    perf->frames[head % PERF_FRAMES] = *frame;
+    __atomic_store_n(&perf->numframes, head + 1, __ATOMIC_RELEASE);
+
+    memset(frame, 0, sizeof(perf_frame_t));
+    frame->start = ms_between(perf, perf->origin, perf->mark);
+}
+
+void
+perf_input(perf_t* perf, Uint32 timestamp) {
+    /* Backdate the click by the time it sat in the event queue */
+    Uint64 now = SDL_GetPerformanceCounter();
+    Uint64 queued = (Uint64)(SDL_GetTicks() - timestamp) * perf->freq / 1000;
+    if (perf->numpending < MAX_PENDING) {
+        perf->pending[perf->numpending++] = queued < now - perf->origin ? now - queued : perf->origin;
+    }
+}
+
+void
+perf_presented(perf_t* perf) {
+    Uint64 now = SDL_GetPerformanceCounter();
+    for (int i=0; i<perf->numpending; i++) {
+        float ms = (float)ms_between(perf, perf->pending[i], now);
+        Uint64 head = perf->numinputs;
+        perf->latency[head % PERF_INPUTS] = ms;
+        __atomic_store_n(&perf->numinputs, head + 1, __ATOMIC_RELEASE);
+        perf->current.inputs++;
+        perf->current.latency = SDL_max(perf->current.latency, ms);
+    }
+    perf->numpending = 0;
+}
+
+size_t
+perf_frames(const perf_t* perf, perf_frame_t* out, size_t max, Uint64* first) {
+    Uint64 head = __atomic_load_n(&perf->numframes, __ATOMIC_ACQUIRE);
+    Uint64 num = SDL_min(head, (Uint64)SDL_min(max, PERF_FRAMES));
+    for (Uint64 i=0; i<num; i++) {
+        out[i] = perf->frames[(head - num + i) % PERF_FRAMES];
+    }
+    /* The writer may have lapped the oldest slots while they were copied:
+     * frame i is intact only if frame i + PERF_FRAMES was not yet started */
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    Uint64 after = __atomic_load_n(&perf->numframes, __ATOMIC_RELAXED);
+    Uint64 oldest = after + 1 > PERF_FRAMES ? after + 1 - PERF_FRAMES : 0;
+    Uint64 skip = oldest > head - num ? SDL_min(oldest - (head - num), num) : 0;
+    memmove(out, out + skip, (size_t)(num - skip) * sizeof(perf_frame_t));
+    if (first) {
+        *first = head - num + skip;
+    }
+    return (size_t)(num - skip);
+}
+
+void
+perf_stats(const perf_t* perf, perf_stats_t* stats) {
+    perf_frame_t frames[PERF_WINDOW];
+    float values[SDL_max(PERF_WINDOW, PERF_INPUTS)];
+    size_t num = perf_frames(perf, frames, PERF_WINDOW, NULL);
+
+    memset(stats, 0, sizeof(perf_stats_t));
+    if (num == 0) {
+        return;
+    }
+    double total = 0.0;
+    for (size_t i=0; i<num; i++) {
+        values[i] = frames[i].frame;
+        total += frames[i].frame;
+        for (int s=0; s<PERF_NUM_STAGES; s++) {
+            stats->stage[s] += frames[i].stage[s] / num;
+        }
+        if (frames[i].drawcalls > 0) {
+            stats->drawcalls = frames[i].drawcalls;
+            stats->cells = frames[i].cells;
+        }
+    }
+    stats->fps = total > 0.0 ? (float)(num * 1000.0 / total) : 0.0f;
+    stats->frame50 = percentile(values, num, 0.50);
+    stats->frame99 = percentile(values, num, 0.99);
+    for (size_t i=0; i<num; i++) {
+        values[i] = frames[i].frame - frames[i].stage[PERF_IDLE];
+    }
+    stats->busy50 = percentile(values, num, 0.50);
+    stats->busy99 = percentile(values, num, 0.99);
+
+    num = copy_latencies(perf, values, PERF_INPUTS);
+    if (num > 0) {
+        stats->latency50 = percentile(values, num, 0.50);
+        stats->latency99 = percentile(values, num, 0.99);
+    }
+}
+
+SDL_bool
+perf_dump(const perf_t* perf, const char* path) {
+    size_t len = strlen(path);
+    SDL_bool json = len >= 5 && SDL_strcasecmp(path + len - 5, ".json") == 0;
+    perf_frame_t* frames = malloc(PERF_FRAMES * sizeof(perf_frame_t));
+    float* latency = malloc(PERF_INPUTS * sizeof(float));
+    FILE* file = NULL;
+    if (frames && latency) {
+        file = fopen(path, "w");
+    }
+    if (!file) {
+        free(frames);
+        free(latency);
+        return SDL_FALSE;
+    }
+    Uint64 first;
+    size_t numframes = perf_frames(perf, frames, PERF_FRAMES, &first);
+    size_t numinputs = copy_latencies(perf, latency, PERF_INPUTS);
+
+    /* One row per frame; the CSV carries each frame's worst latency and
+     * the JSON every click's as well */
+    if (json) {
+        fprintf(file, "{\n  \"frames\": [\n");
+    } else {
+        fprintf(file, "frame,start_ms");
+        for (int s=0; s<PERF_NUM_STAGES; s++) {
+            fprintf(file, ",%s_ms", stage_names[s]);
+        }
+        fprintf(file, ",frame_ms,drawcalls,cells,inputs,latency_ms\n");
+    }
+    for (size_t i=0; i<numframes; i++) {
+        const perf_frame_t* f = &frames[i];
+        if (json) {
+            fprintf(file, "    {\"frame\": %llu, \"start_ms\": %.3f", (unsigned long long)(first + i), f->start);
+            for (int s=0; s<PERF_NUM_STAGES; s++) {
+                fprintf(file, ", \"%s_ms\": %.4f", stage_names[s], f->stage[s]);
+            }
+            fprintf(file, ", \"frame_ms\": %.4f, \"drawcalls\": %d, \"cells\": %d, \"inputs\": %d, \"latency_ms\": %.3f}%s\n",
+                    f->frame, f->drawcalls, f->cells, f->inputs, f->latency, i+1 < numframes ? "," : "");
+        } else {
+            fprintf(file, "%llu,%.3f", (unsigned long long)(first + i), f->start);
+            for (int s=0; s<PERF_NUM_STAGES; s++) {
+                fprintf(file, ",%.4f", f->stage[s]);
+            }
+            fprintf(file, ",%.4f,%d,%d,%d,%.3f\n", f->frame, f->drawcalls, f->cells, f->inputs, f->latency);
+        }
+    }
+    if (json) {
+        fprintf(file, "  ],\n  \"latency_ms\": [");
+        for (size_t i=0; i<numinputs; i++) {
+            fprintf(file, "%s%.3f", i ? ", " : "", latency[i]);
+        }
+        fprintf(file, "]\n}\n");
+    }
+    SDL_bool ok = !ferror(file);
+    ok = !fclose(file) && ok;
+    free(frames);
+    free(latency);
+    return ok;
+}
+
+/*============================================================================*/
+
+static double
+ms_between(const perf_t* perf, Uint64 from, Uint64 to) {
+    return (double)(to - from) * 1000.0 / perf->freq;
+}
+
+static size_t
+copy_latencies(const perf_t* perf, float* out, size_t max) {
+    /* Same scheme as perf_frames */
+    Uint64 head = __atomic_load_n(&perf->numinputs, __ATOMIC_ACQUIRE);
+    Uint64 num = SDL_min(head, (Uint64)SDL_min(max, PERF_INPUTS));
+    for (Uint64 i=0; i<num; i++) {
+        out[i] = perf->latency[(head - num + i) % PERF_INPUTS];
+    }
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    Uint64 after = __atomic_load_n(&perf->numinputs, __ATOMIC_RELAXED);
+    Uint64 oldest = after + 1 > PERF_INPUTS ? after + 1 - PERF_INPUTS : 0;
+    Uint64 skip = oldest > head - num ? SDL_min(oldest - (head - num), num) : 0;
+    memmove(out, out + skip, (size_t)(num - skip) * sizeof(float));
+    return (size_t)(num - skip);
+}
+
+static int
+cmp_float(const void* a, const void* b) {
+    float fa = *(const float*)a;
+    float fb = *(const float*)b;
+    return (fa > fb) - (fa < fb);
+}
+
+static float
+percentile(float* values, size_t num, double p) {
+    /* Nearest rank; sorts values in place */
+    qsort(values, num, sizeof(float), cmp_float);
+    size_t rank = (size_t)(p * num + 0.999999);
+    return values[SDL_clamp(rank, 1, num) - 1];
+}
@@ -0,0 +1,71 @@
+#ifndef PERF_H
+#define PERF_H
+
+/* Frame timing and input latency. Every frame is split into stages timed
+ * with the performance counter; finished frames go into a ring that a
+ * reader can copy without locking, and each click is timed from its event
+ * timestamp until the frame that shows it is presented. Cheap enough to
+ * leave on: a few counter reads per frame and no allocation. */
+
+#include <SDL2/SDL.h>
+
+#define PERF_FRAMES (4096)  // frames kept in the ring
+#define PERF_INPUTS (1024)  // click latencies kept
+#define PERF_WINDOW (240)   // recent frames the stats cover
+
+typedef enum {
+    PERF_EVENTS,        // taking queued events from SDL
+    PERF_LOGIC,         // handling events: moves, solver, camera
+    PERF_DRAW,          // draw_cells into the target
+    PERF_PRESENT,       // copy to the window and SDL_RenderPresent
+    PERF_IDLE,          // blocked waiting for an event
+    PERF_NUM_STAGES
+} perf_stage_t;
+
+typedef struct {
+    double start;       // ms since perf_new
+    float stage[PERF_NUM_STAGES];   // ms spent in each stage
+    float frame;        // ms for the whole frame, the sum of the stages
+    int drawcalls;      // render calls submitted
+    int cells;          // cells drawn
+    int inputs;         // clicks presented by this frame
+    float latency;      // worst click to present ms of those, 0 if none
+} perf_frame_t;
+
+typedef struct {
+    float frame50, frame99;     // frame ms, including idle waits for input
+    float busy50, busy99;       // frame ms less idle, the cost of a frame
+    float latency50, latency99; // click to present ms, 0 before any click
+    float stage[PERF_NUM_STAGES];   // mean ms per frame
+    int drawcalls, cells;       // last frame that drew anything
+    float fps;
+} perf_stats_t;
+
+typedef struct perf perf_t;
+
+perf_t* perf_new(void);
+void perf_free(perf_t* perf);
+
+/* Charges the time since the last switch to the current stage and moves
+ * to stage */
+void perf_stage(perf_t* perf, perf_stage_t stage);
+void perf_count(perf_t* perf, int drawcalls, int cells);
+/* Ends the frame, publishes it and starts the next in PERF_EVENTS */
+void perf_frame(perf_t* perf);
+
+/* A click that changed the board; timestamp is the event's, in SDL ticks,
+ * so time spent queued before it was polled counts too */
+void perf_input(perf_t* perf, Uint32 timestamp);
+/* The frame showing every pending click has just been presented */
+void perf_presented(perf_t* perf);
+
+/* Copies up to max of the newest frames, oldest first, and returns how
+ * many. Safe against a writer on another thread: slots it reuses during
+ * the copy are dropped. first, if given, gets the number of the first. */
+size_t perf_frames(const perf_t* perf, perf_frame_t* out, size_t max, Uint64* first);
+void perf_stats(const perf_t* perf, perf_stats_t* stats);
+/* Writes every kept frame and latency, as JSON if path ends in .json and
+ * as CSV otherwise. Returns false if the file could not be written. */
+SDL_bool perf_dump(const perf_t* perf, const char* path);
+
+#endif
@@ -0,0 +1,210 @@
+/* The board core on boards of any size, 1xN included: the first reveal
+ * places exactly nummines mines, none on or (if there is room) around the
+ * clicked cell, the same for the same seed; every cell's count matches
+ * its neighbours counted one by one; it opens exactly the region a plain
+ * flood fill opens, and every move lists the cells it changed. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../core/board.h"
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: failed: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/*============================================================================*/
+int failures = 0;
+
+static const board_params_t shapes[] = {
+    {1, 1, 0, 1, false, 0, false, 1},
+    {1, 50, 10, 2, false, 0, false, 1},
+    {50, 1, 10, 3, false, 0, false, 1},
+    {3, 200, 100, 4, false, 0, false, 1},
+    {200, 3, 100, 5, false, 0, false, 1},
+    {17, 13, 60, 6, false, 0, false, 1},
+    {64, 64, 800, 7, false, 0, false, 1},
+    {301, 7, 400, 8, false, 0, false, 1},
+    /* Widths around the 16 and 32 byte vector kernels and their tails */
+    {15, 9, 30, 12, false, 0, false, 1},
+    {16, 16, 40, 13, false, 0, false, 1},
+    {32, 5, 40, 14, false, 0, false, 1},
+    {33, 9, 70, 15, false, 0, false, 1},
+    /* Too dense for a clear 3x3, so only the clicked cell is safe */
+    {10, 10, 99, 9, false, 0, false, 1},
+    {1, 30, 29, 10, false, 0, false, 1},
+    {8, 8, 60, 11, false, 0, false, 1},
+};
+#define NUM_SHAPES ((int)(sizeof(shapes) / sizeof(shapes[0])))
+
+void check_invalid(void);
+void check_placement(board_t* board, board_t* twin, int x, int y);
+void check_counts(board_t* board);
+void check_flood(board_t* board, int x, int y);
+void flood(board_t* board, int x, int y, uint8_t* open);
+/*================================================*/
+
+int
+main(void) {
+    check_invalid();
+    for (int s=0; s<NUM_SHAPES; s++) {
+        const board_params_t* params = &shapes[s];
+        board_t* board = board_new(params);
+        board_t* twin = board_new(params);
+        CHECK(board && twin);
+        if (!board || !twin) {
+            continue;
+        }
+        for (uint64_t seed=1; seed<=20; seed++) {
+            int x = (int)(seed * 7 % params->width);
+            int y = (int)(seed * 5 % params->height);
+            board_reset(board, params->seed * 1000 + seed);
+            board_reset(twin, params->seed * 1000 + seed);
+            check_flood(board, x, y);
+            check_placement(board, twin, x, y);
+            check_counts(board);
+        }
+        board_free(board);
+        board_free(twin);
+    }
+
+    if (failures) {
+        printf("test_board: %d failures\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("test_board: ok\n");
+    return EXIT_SUCCESS;
+}
+
+void
+check_invalid(void) {
+    /* No cells, or no safe cell left */
+    board_params_t params = {0, 5, 0, 1, false, 0, false, 1};
+    CHECK(board_new(&params) == NULL);
+    params = (board_params_t){5, 0, 0, 1, false, 0, false, 1};
+    CHECK(board_new(&params) == NULL);
+    params = (board_params_t){5, 5, 25, 1, false, 0, false, 1};
+    CHECK(board_new(&params) == NULL);
+    params = (board_params_t){5, 5, -1, 1, false, 0, false, 1};
+    CHECK(board_new(&params) == NULL);
+}
+
+void
+check_placement(board_t* board, board_t* twin, int x, int y) {
+    /* board has had its first reveal at (x,y); twin, reset to the same
+     * seed, gets the same click and must get the same layout */
+    const board_params_t* params = board_params(board);
+    int w = params->width, h = params->height;
+    size_t n = (size_t)w * h;
+    int around = 0;
+    for (int dy=-1; dy<=1; dy++) {
+        for (int dx=-1; dx<=1; dx++) {
+            around += x+dx >= 0 && x+dx < w && y+dy >= 0 && y+dy < h;
+        }
+    }
+    bool roomy = (size_t)params->nummines <= n - around;
+
+    board_reveal(twin, x, y);
+    size_t mines = 0, near = 0, differ = 0;
+    for (int cy=0; cy<h; cy++) {
+        for (int cx=0; cx<w; cx++) {
+            cell_t mine = board_peek(board, cx, cy) & CELL_MINE;
+            mines += mine != 0;
+            near += mine && abs(cx - x) <= 1 && abs(cy - y) <= 1;
+            differ += mine != (board_peek(twin, cx, cy) & CELL_MINE);
+        }
+    }
+    CHECK(board_generated(board));
+    CHECK(mines == (size_t)params->nummines);
+    CHECK(!(board_peek(board, x, y) & CELL_MINE));
+    CHECK(!roomy || near == 0);
+    CHECK(differ == 0);
+}
+
+void
+check_counts(board_t* board) {
+    const board_params_t* params = board_params(board);
+    int w = params->width, h = params->height;
+    size_t wrong = 0;
+    for (int y=0; y<h; y++) {
+        for (int x=0; x<w; x++) {
+            int count = 0;
+            for (int dy=-1; dy<=1; dy++) {
+                for (int dx=-1; dx<=1; dx++) {
+                    int nx = x + dx, ny = y + dy;
+                    if ((dx || dy) && nx >= 0 && ny >= 0 && nx < w && ny < h) {
+                        count += (board_peek(board, nx, ny) & CELL_MINE) != 0;
+                    }
+                }
+            }
+            wrong += (board_peek(board, x, y) & CELL_COUNT) != count;
+        }
+    }
+    if (wrong) {
+        printf("%dx%d seed %llu: %zu wrong counts\n", w, h, (unsigned long long)params->seed, wrong);
+        failures++;
+    }
+}
+
+void
+check_flood(board_t* board, int x, int y) {
+    /* The first reveal opens what flood() opens from the same cell, lists
+     * each of those cells once, and wins if nothing safe is left */
+    const board_params_t* params = board_params(board);
+    int w = params->width;
+    size_t n = (size_t)w * params->height;
+    uint8_t* open = calloc(n, 1);
+    uint8_t* listed = calloc(n, 1);
+    CHECK(open && listed);
+
+    size_t changed = board_reveal(board, x, y);
+    flood(board, x, y, open);
+    size_t expected = 0, wrong = 0, revealed = 0;
+    for (size_t i=0; i<n; i++) {
+        bool isopen = (board_peek(board, (int)(i % w), (int)(i / w)) & CELL_REVEALED) != 0;
+        expected += open[i];
+        revealed += isopen;
+        wrong += isopen != open[i];
+    }
+    size_t num;
+    const coord_t* cells = board_changes(board, &num);
+    for (size_t i=0; i<num; i++) {
+        size_t at = (size_t)cells[i].y * w + cells[i].x;
+        wrong += listed[at] || !open[at];
+        listed[at] = 1;
+    }
+    if (wrong || changed != expected || num != expected) {
+        printf("%dx%d seed %llu, reveal (%d,%d): %zu wrong cells, %zu changed, %zu expected\n", w, params->height,
+               (unsigned long long)params->seed, x, y, wrong, changed, expected);
+        failures++;
+    }
+    bool won = revealed == n - params->nummines;
+    CHECK(board_status(board) == (won ? BOARD_WON : BOARD_PLAYING));
+    free(open);
+    free(listed);
+}
+
+void
+flood(board_t* board, int x, int y, uint8_t* open) {
+    /* Opens (x,y) and spreads from every open zero to its neighbours,
+     * rescanning the whole board until nothing changes */
+    const board_params_t* params = board_params(board);
+    int w = params->width, h = params->height;
+    open[(size_t)y * w + x] = 1;
+    for (bool grew=true; grew; ) {
+        grew = false;
+        for (int cy=0; cy<h; cy++) {
+            for (int cx=0; cx<w; cx++) {
+                if (!open[(size_t)cy * w + cx] || (board_peek(board, cx, cy) & (CELL_COUNT | CELL_MINE))) {
+                    continue;
+                }
+                for (int dy=-1; dy<=1; dy++) {
+                    for (int dx=-1; dx<=1; dx++) {
+                        int nx = cx + dx, ny = cy + dy;
+                        if (nx >= 0 && ny >= 0 && nx < w && ny < h && !open[(size_t)ny * w + nx]) {
+                            open[(size_t)ny * w + nx] = 1;
+                            grew = true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
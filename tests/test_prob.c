@@ -0,0 +1,235 @@
+/* prob_compute must stay exact on ordinary boards and return in bounded
+ * time on boards whose frontier is too tangled to enumerate, estimating
+ * those components instead of freezing the caller. Exact means equal to
+ * counting every layout consistent with the numbers, which is done by
+ * brute force on boards small enough for it. */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../core/board.h"
+#include "../core/prob.h"
+#include "../core/rng.h"
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: failed: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+#define TIME_LIMIT (2.0)    // seconds one prob_compute may take
+#define MAX_BRUTE (22)      // hidden cells brute force still counts quickly
+#define TOLERANCE (1e-6)
+
+/*============================================================================*/
+int failures = 0;
+
+double seconds(void);
+void reveal_random(board_t* board, rng_t* rng, int count);
+void check_probabilities(board_t* board, const prob_t* prob);
+void check_exact(board_t* board, const prob_t* prob);
+void count_layouts(board_t* board, const int* hidden, int numhidden, int left, uint8_t* mine,
+                   double* hits, double* total);
+bool consistent(board_t* board, const uint8_t* mine);
+/*================================================*/
+
+int
+main(void) {
+    /* Expert board: small components, enumerated exactly */
+    board_params_t expert = {.width = 30, .height = 16, .nummines = 99, .seed = 1};
+    board_t* board = board_new(&expert);
+    prob_t* prob = prob_new(board, 2);
+    CHECK(board && prob);
+    board_reveal(board, 15, 8);
+    CHECK(prob_compute(prob));
+    CHECK(prob_exact(prob));
+    check_probabilities(board, prob);
+    prob_free(prob);
+    board_free(board);
+
+    /* Small boards played out by prob_best, each position checked against
+     * every layout; one engine per board so cached components are reused
+     * across moves and games */
+    board_params_t small[] = {
+        {.width = 5, .height = 4, .nummines = 4},
+        {.width = 6, .height = 5, .nummines = 6},
+        {.width = 7, .height = 4, .nummines = 5},
+    };
+    for (int s=0; s<(int)(sizeof(small) / sizeof(small[0])); s++) {
+        board = board_new(&small[s]);
+        prob = prob_new(board, 2);
+        CHECK(board && prob);
+        for (uint64_t seed=1; seed<=40; seed++) {
+            board_reset(board, seed);
+            board_reveal(board, small[s].width / 2, small[s].height / 2);
+            while (board_status(board) == BOARD_PLAYING) {
+                coord_t best;
+                CHECK(prob_compute(prob));
+                CHECK(prob_exact(prob));
+                check_exact(board, prob);
+                if (!prob_best(prob, &best)) {
+                    break;
+                }
+                board_reveal(board, best.x, best.y);
+            }
+        }
+        prob_free(prob);
+        board_free(board);
+    }
+
+    /* 100x100 with 2000 mines: opened at random, the frontier becomes one
+     * huge component that exact enumeration would take minutes on */
+    board_params_t dense = {.width = 100, .height = 100, .nummines = 2000, .seed = 4};
+    board = board_new(&dense);
+    prob = prob_new(board, 2);
+    CHECK(board && prob);
+    board_reveal(board, 50, 50);
+    rng_t rng;
+    rng_seed(&rng, 1);
+    for (int step=0; step<5; step++) {
+        reveal_random(board, &rng, 200);
+        double start = seconds();
+        CHECK(prob_compute(prob));
+        double took = seconds() - start;
+        if (took > TIME_LIMIT) {
+            printf("dense board, step %d: prob_compute took %.2f s\n", step, took);
+            failures++;
+        }
+        check_probabilities(board, prob);
+    }
+    prob_free(prob);
+    board_free(board);
+
+    if (failures) {
+        printf("test_prob: %d failures\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("test_prob: ok\n");
+    return EXIT_SUCCESS;
+}
+
+double
+seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+void
+reveal_random(board_t* board, rng_t* rng, int count) {
+    /* Reveals up to count safe cells picked at random, like a player that
+     * never guesses wrong */
+    board_params_t params = *board_params(board);
+    for (long tries=0; count > 0 && tries < 1000000; tries++) {
+        int x = (int)rng_below(rng, params.width);
+        int y = (int)rng_below(rng, params.height);
+        cell_t cell = board_peek(board, x, y);
+        if (!(cell & (CELL_MINE | CELL_REVEALED))) {
+            board_reveal(board, x, y);
+            count--;
+        }
+    }
+}
+
+void
+check_probabilities(board_t* board, const prob_t* prob) {
+    /* Hidden cells get a probability, revealed ones -1, and the best cell
+     * is hidden */
+    const board_params_t* params = board_params(board);
+    int bad = 0;
+    for (int y=0; y<params->height; y++) {
+        for (int x=0; x<params->width; x++) {
+            double p = prob_mine(prob, x, y);
+            if (board_peek(board, x, y) & CELL_REVEALED) {
+                bad += p != -1.0;
+            } else {
+                bad += !(p >= 0.0 && p <= 1.0);
+            }
+        }
+    }
+    CHECK(bad == 0);
+    coord_t best;
+    CHECK(prob_best(prob, &best));
+    CHECK(!(board_peek(board, best.x, best.y) & CELL_REVEALED));
+}
+
+void
+check_exact(board_t* board, const prob_t* prob) {
+    /* Every hidden cell's probability is the share of consistent layouts
+     * with a mine there */
+    const board_params_t* params = board_params(board);
+    int n = params->width * params->height;
+    int hidden[MAX_BRUTE];
+    int numhidden = 0;
+    for (int i=0; i<n; i++) {
+        if (!(board_peek(board, i % params->width, i / params->width) & CELL_REVEALED)) {
+            if (numhidden == MAX_BRUTE) {
+                return;
+            }
+            hidden[numhidden++] = i;
+        }
+    }
+    uint8_t* mine = calloc(n, 1);
+    double* hits = calloc(n, sizeof(double));
+    double total = 0.0;
+    CHECK(mine && hits);
+    count_layouts(board, hidden, numhidden, params->nummines, mine, hits, &total);
+    CHECK(total > 0.0);
+    for (int k=0; total > 0.0 && k<numhidden; k++) {
+        int i = hidden[k];
+        double p = prob_mine(prob, i % params->width, i / params->width);
+        if (fabs(p - hits[i] / total) > TOLERANCE) {
+            printf("%dx%d seed %llu, (%d,%d): %.9f, brute force %.9f\n", params->width, params->height,
+                   (unsigned long long)params->seed, i % params->width, i / params->width, p, hits[i] / total);
+            failures++;
+        }
+    }
+    free(mine);
+    free(hits);
+}
+
+void
+count_layouts(board_t* board, const int* hidden, int numhidden, int left, uint8_t* mine,
+              double* hits, double* total) {
+    /* Places the left mines in every way among the hidden cells */
+    if (left == 0) {
+        if (consistent(board, mine)) {
+            const board_params_t* params = board_params(board);
+            *total += 1.0;
+            for (int i=0; i<params->width * params->height; i++) {
+                hits[i] += mine[i];
+            }
+        }
+        return;
+    }
+    if (numhidden < left) {
+        return;
+    }
+    mine[hidden[0]] = 1;
+    count_layouts(board, hidden + 1, numhidden - 1, left - 1, mine, hits, total);
+    mine[hidden[0]] = 0;
+    count_layouts(board, hidden + 1, numhidden - 1, left, mine, hits, total);
+}
+
+bool
+consistent(board_t* board, const uint8_t* mine) {
+    /* Every revealed number matches the mines around it */
+    const board_params_t* params = board_params(board);
+    for (int y=0; y<params->height; y++) {
+        for (int x=0; x<params->width; x++) {
+            cell_t cell = board_peek(board, x, y);
+            if (!(cell & CELL_REVEALED)) {
+                continue;
+            }
+            int count = 0;
+            for (int dy=-1; dy<=1; dy++) {
+                for (int dx=-1; dx<=1; dx++) {
+                    int nx = x + dx, ny = y + dy;
+                    if ((dx || dy) && nx >= 0 && ny >= 0 && nx < params->width && ny < params->height) {
+                        count += mine[ny * params->width + nx];
+                    }
+                }
+            }
+            if (count != (cell & CELL_COUNT)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,153 @@
+/* A recording must play back to the board that was recorded, move by move
+ * and from any seek, including one started from a loaded save rather than
+ * a new board. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "../core/board.h"
+#include "../core/replay.h"
+#include "../core/rng.h"
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: failed: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+#define MAX_MOVES (400)
+#define STATE_BITS (CELL_REVEALED | CELL_FLAG | CELL_MINE)
+
+/*============================================================================*/
+int failures = 0;
+
+size_t play(board_t* board, replay_writer_t* writer, rng_t* rng, int moves, cell_t* snapshots);
+void snapshot(board_t* board, cell_t* out);
+void check_playback(const char* path, const cell_t* snapshots, size_t moves, const char* what);
+/*================================================*/
+
+int
+main(void) {
+    char savepath[256], replaypath[256];
+    snprintf(savepath, sizeof(savepath), "/tmp/test_replay_%d.msb", (int)getpid());
+    snprintf(replaypath, sizeof(replaypath), "/tmp/test_replay_%d.msr", (int)getpid());
+    board_params_t params = {30, 16, 99, 3, false, 0, false, 1};
+    size_t n = (size_t)params.width * params.height;
+    cell_t* snapshots = malloc((MAX_MOVES + 1) * n);
+    CHECK(snapshots != NULL);
+    rng_t rng;
+    rng_seed(&rng, 5);
+
+    /* A new board, recorded from the first click */
+    board_t* board = board_new(&params);
+    replay_writer_t* writer = replay_create(replaypath, board, 16);
+    CHECK(board && writer);
+    size_t moves = play(board, writer, &rng, MAX_MOVES, snapshots);
+    CHECK(replay_finish(writer));
+    check_playback(replaypath, snapshots, moves, "new board");
+
+    /* Part of another game saved and loaded, then recorded onwards */
+    board_reset(board, 11);
+    play(board, NULL, &rng, 40, snapshots);
+    CHECK(board_save(board, savepath));
+    board_free(board);
+    board = board_load(savepath);
+    CHECK(board != NULL);
+    writer = replay_create(replaypath, board, 16);
+    CHECK(writer != NULL);
+    moves = play(board, writer, &rng, MAX_MOVES, snapshots);
+    CHECK(replay_finish(writer));
+    check_playback(replaypath, snapshots, moves, "loaded board");
+
+    board_free(board);
+    free(snapshots);
+    remove(savepath);
+    remove(replaypath);
+    if (failures) {
+        printf("test_replay: %d failures\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("test_replay: ok\n");
+    return EXIT_SUCCESS;
+}
+
+size_t
+play(board_t* board, replay_writer_t* writer, rng_t* rng, int moves, cell_t* snapshots) {
+    /* Clicks random cells: reveals, flags mines instead of hitting them and
+     * chords numbers. snapshots[m] gets the board after m moves. */
+    const board_params_t* params = board_params(board);
+    size_t n = (size_t)params->width * params->height;
+    int m = 0;
+    snapshot(board, snapshots);
+    while (m < moves && board_status(board) == BOARD_PLAYING) {
+        int x = (int)rng_below(rng, params->width);
+        int y = (int)rng_below(rng, params->height);
+        cell_t cell = board_peek(board, x, y);
+        replay_action_t action = REPLAY_REVEAL;
+        if (cell & CELL_REVEALED) {
+            action = REPLAY_CHORD;
+            board_chord(board, x, y);
+        } else if ((cell & CELL_MINE) || ((cell & CELL_FLAG) && rng_below(rng, 2))) {
+            action = REPLAY_FLAG;
+            board_flag(board, x, y);
+        } else {
+            board_reveal(board, x, y);
+        }
+        m++;
+        if (writer) {
+            replay_record(writer, board, action, x, y, (uint32_t)m * 10);
+        }
+        snapshot(board, snapshots + (size_t)m * n);
+    }
+    return (size_t)m;
+}
+
+void
+snapshot(board_t* board, cell_t* out) {
+    const board_params_t* params = board_params(board);
+    for (int y=0; y<params->height; y++) {
+        for (int x=0; x<params->width; x++) {
+            out[(size_t)y * params->width + x] = board_peek(board, x, y) & STATE_BITS;
+        }
+    }
+}
+
+void
+check_playback(const char* path, const cell_t* snapshots, size_t moves, const char* what) {
+    /* Steps through every move with every keyframe verified, then seeks to
+     * a spread of moves, comparing the board with what was recorded */
+    replay_t* replay = replay_open(path);
+    CHECK(replay != NULL);
+    if (!replay) {
+        return;
+    }
+    const board_params_t* params = replay_params(replay);
+    size_t n = (size_t)params->width * params->height;
+    cell_t* now = malloc(n);
+    board_t* board = board_new(params);
+    CHECK(now && board);
+    if (replay_length(replay) != moves) {
+        printf("%s: %zu moves recorded, %zu read\n", what, moves, replay_length(replay));
+        failures++;
+    }
+
+    CHECK(replay_seek(replay, board, 0));
+    replay_event_t event;
+    size_t bad = 0;
+    for (size_t m=0; m<=moves; m++) {
+        snapshot(board, now);
+        bad += memcmp(now, snapshots + m * n, n) != 0;
+        if (m < moves) {
+            bad += !replay_step(replay, board, &event);
+            bad += !replay_verify(replay, board);
+        }
+    }
+    for (size_t m=0; m<=moves; m+=7) {
+        bad += !replay_seek(replay, board, m);
+        snapshot(board, now);
+        bad += memcmp(now, snapshots + m * n, n) != 0;
+    }
+    if (bad) {
+        printf("%s: %zu mismatches\n", what, bad);
+        failures++;
+    }
+    free(now);
+    board_free(board);
+    replay_close(replay);
+}
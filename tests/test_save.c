@@ -0,0 +1,130 @@
+/* board_load must refuse anything that is not a save it can read without
+ * touching the file, and report a missing file as ENOENT so that only
+ * then does the game start a new board there. */
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "../core/board.h"
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: failed: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/*============================================================================*/
+int failures = 0;
+
+unsigned char* read_file(const char* path, size_t* size);
+void write_file(const char* path, const unsigned char* data, size_t size);
+void check_rejected(const char* path, const char* what);
+/*================================================*/
+
+int
+main(void) {
+    char path[256];
+    snprintf(path, sizeof(path), "/tmp/test_save_%d.msb", (int)getpid());
+
+    /* Missing */
+    remove(path);
+    errno = 0;
+    CHECK(board_load(path) == NULL);
+    CHECK(errno == ENOENT);
+
+    /* Garbage, larger than a header page */
+    unsigned char garbage[3*4096];
+    srand(1);
+    for (size_t i=0; i<sizeof(garbage); i++) {
+        garbage[i] = (unsigned char)rand();
+    }
+    write_file(path, garbage, sizeof(garbage));
+    check_rejected(path, "garbage");
+
+    /* Short, not even a header */
+    write_file(path, (const unsigned char*)"MSBOARD", 8);
+    check_rejected(path, "short file");
+
+    /* A real save, then the same with a future version and truncated */
+    board_params_t params = {16, 16, 40, 7, false, 0, false, 1};
+    board_t* board = board_new(&params);
+    CHECK(board != NULL);
+    board_reveal(board, 8, 8);
+    CHECK(board_save(board, path));
+    board_free(board);
+    size_t size;
+    unsigned char* save = read_file(path, &size);
+    board = board_load(path);
+    CHECK(board != NULL);
+    board_free(board);
+
+    uint32_t version;
+    memcpy(&version, save + 8, sizeof(version));
+    version++;
+    memcpy(save + 8, &version, sizeof(version));
+    write_file(path, save, size);
+    check_rejected(path, "wrong version");
+
+    version--;
+    memcpy(save + 8, &version, sizeof(version));
+    write_file(path, save, size - 1);
+    check_rejected(path, "truncated save");
+
+    free(save);
+    remove(path);
+    if (failures) {
+        printf("test_save: %d failures\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("test_save: ok\n");
+    return EXIT_SUCCESS;
+}
+
+unsigned char*
+read_file(const char* path, size_t* size) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        printf("Error reading %s\n", path);
+        exit(EXIT_FAILURE);
+    }
+    fseek(file, 0, SEEK_END);
+    *size = (size_t)ftell(file);
+    fseek(file, 0, SEEK_SET);
+    unsigned char* data = malloc(*size ? *size : 1);
+    if (!data || fread(data, 1, *size, file) != *size) {
+        printf("Error reading %s\n", path);
+        exit(EXIT_FAILURE);
+    }
+    fclose(file);
+    return data;
+}
+
+void
+write_file(const char* path, const unsigned char* data, size_t size) {
+    FILE* file = fopen(path, "wb");
+    if (!file || fwrite(data, 1, size, file) != size || fclose(file)) {
+        printf("Error writing %s\n", path);
+        exit(EXIT_FAILURE);
+    }
+}
+
+void
+check_rejected(const char* path, const char* what) {
+    /* Load fails with EINVAL and leaves every byte as it was */
+    size_t before, after;
+    unsigned char* old = read_file(path, &before);
+    errno = 0;
+    board_t* board = board_load(path);
+    if (board) {
+        printf("%s: loaded\n", what);
+        failures++;
+        board_free(board);
+    } else if (errno != EINVAL) {
+        printf("%s: errno %d, expected EINVAL\n", what, errno);
+        failures++;
+    }
+    unsigned char* now = read_file(path, &after);
+    if (before != after || memcmp(old, now, before) != 0) {
+        printf("%s: file changed\n", what);
+        failures++;
+    }
+    free(old);
+    free(now);
+}
@@ -0,0 +1,225 @@
+/* The solver only ever deduces what is true, finds what the single-point
+ * and subset rules give on hand-built layouts, and, fed move by move,
+ * ends up knowing what a fresh solver fed every revealed cell at once
+ * knows. No-guess boards are ones it wins from the first click, and the
+ * same whatever the number of threads searching for them. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../core/board_impl.h"
+#include "../core/solver.h"
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: failed: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/*============================================================================*/
+int failures = 0;
+
+board_t* make_board(int width, int height, const char* layout);
+void reveal(board_t* board, solver_t* solver, int x, int y);
+int play_safe(board_t* board, solver_t* solver);
+void check_patterns(void);
+void check_games(void);
+void check_noguess(void);
+/*================================================*/
+
+int
+main(void) {
+    check_patterns();
+    check_games();
+    check_noguess();
+
+    if (failures) {
+        printf("test_solver: %d failures\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("test_solver: ok\n");
+    return EXIT_SUCCESS;
+}
+
+board_t*
+make_board(int width, int height, const char* layout) {
+    /* A board with its mines where layout, row by row, has a '*' */
+    board_params_t params = {width, height, 0, 1, false, 0, false, 1};
+    for (const char* c=layout; *c; c++) {
+        params.nummines += *c == '*';
+    }
+    board_t* board = board_new(&params);
+    if (!board) {
+        printf("Error allocating a %dx%d board\n", width, height);
+        exit(EXIT_FAILURE);
+    }
+    for (int i=0; i<width*height; i++) {
+        board->cells[i] = layout[i] == '*' ? CELL_MINE : 0;
+    }
+    generate_touching_details(board);
+    board->generated = true;
+    return board;
+}
+
+void
+reveal(board_t* board, solver_t* solver, int x, int y) {
+    size_t num;
+    board_reveal(board, x, y);
+    const coord_t* changed = board_changes(board, &num);
+    solver_update(solver, changed, num);
+}
+
+int
+play_safe(board_t* board, solver_t* solver) {
+    /* Reveals what the solver proves safe until it is stuck; returns how
+     * many of those turned out to be mines */
+    coord_t cell;
+    int wrong = 0;
+    while (board_status(board) == BOARD_PLAYING && solver_next_safe(solver, &cell)) {
+        wrong += (board_peek(board, cell.x, cell.y) & CELL_MINE) != 0;
+        reveal(board, solver, cell.x, cell.y);
+    }
+    return wrong;
+}
+
+void
+check_patterns(void) {
+    /* 1-1-2-1-1 under a hidden row: the subset rule clears the middle,
+     * then the 2 needs both its other cells and the ends clear */
+    board_t* board = make_board(5, 3,
+        ".*.*."
+        "....."
+        ".....");
+    solver_t* solver = solver_new(board);
+    CHECK(solver != NULL);
+    reveal(board, solver, 2, 2);
+    CHECK(play_safe(board, solver) == 0);
+    CHECK(board_status(board) == BOARD_WON);
+    CHECK(solver_known(solver, 1, 0) == SOLVER_MINE);
+    CHECK(solver_known(solver, 3, 0) == SOLVER_MINE);
+    size_t num;
+    solver_mines(solver, &num);
+    CHECK(num == 2);
+    solver_free(solver);
+    board_free(board);
+
+    /* Two 1s over the same two cells: a true 50/50, nothing to deduce */
+    board = make_board(2, 2,
+        "*."
+        "..");
+    solver = solver_new(board);
+    reveal(board, solver, 0, 1);
+    reveal(board, solver, 1, 1);
+    coord_t cell;
+    CHECK(!solver_next_safe(solver, &cell));
+    CHECK(solver_known(solver, 0, 0) == SOLVER_UNKNOWN);
+    CHECK(solver_known(solver, 1, 0) == SOLVER_UNKNOWN);
+    solver_free(solver);
+    board_free(board);
+
+    /* A 1 in the corner with one hidden neighbour: single-point rule */
+    board = make_board(3, 1, "*..");
+    solver = solver_new(board);
+    reveal(board, solver, 2, 0);
+    CHECK(solver_known(solver, 0, 0) == SOLVER_MINE);
+    CHECK(!solver_next_safe(solver, &cell));
+    solver_free(solver);
+    board_free(board);
+}
+
+void
+check_games(void) {
+    /* Expert games played only on the solver's word, one solver reset
+     * between games: it never calls a mine safe or a safe cell a mine, and
+     * a fresh solver fed every revealed cell at once agrees with it */
+    board_params_t params = {30, 16, 99, 1, false, 0, false, 1};
+    board_t* board = board_new(&params);
+    solver_t* solver = board ? solver_new(board) : NULL;
+    CHECK(board && solver);
+    if (!solver) {
+        return;
+    }
+    coord_t* open = malloc((size_t)params.width * params.height * sizeof(coord_t));
+    CHECK(open != NULL);
+    int wins = 0;
+    for (uint64_t seed=1; seed<=100; seed++) {
+        board_reset(board, seed);
+        solver_reset(solver);
+        reveal(board, solver, params.width / 2, params.height / 2);
+        CHECK(play_safe(board, solver) == 0);
+        wins += board_status(board) == BOARD_WON;
+
+        solver_t* fresh = solver_new(board);
+        size_t numopen = 0, wrong = 0, differ = 0;
+        for (int y=0; y<params.height; y++) {
+            for (int x=0; x<params.width; x++) {
+                if (board_peek(board, x, y) & CELL_REVEALED) {
+                    open[numopen++] = (coord_t){x, y};
+                }
+            }
+        }
+        solver_update(fresh, open, numopen);
+        for (int y=0; y<params.height; y++) {
+            for (int x=0; x<params.width; x++) {
+                cell_t cell = board_peek(board, x, y);
+                solver_known_t known = solver_known(solver, x, y);
+                wrong += known == SOLVER_MINE && !(cell & CELL_MINE);
+                wrong += known == SOLVER_SAFE && (cell & CELL_MINE);
+                differ += !(cell & CELL_REVEALED) && known != solver_known(fresh, x, y);
+            }
+        }
+        if (wrong || differ) {
+            printf("seed %llu: %zu wrong deductions, %zu differ from a fresh solver\n",
+                   (unsigned long long)seed, wrong, differ);
+            failures++;
+        }
+        solver_free(fresh);
+    }
+    /* Only a few percent of expert games need no guess after the first
+     * click; 4 of these seeds do */
+    CHECK(wins > 0);
+    free(open);
+    solver_free(solver);
+    board_free(board);
+}
+
+void
+check_noguess(void) {
+    static const int threads[] = {1, 2, 4};
+    board_params_t params = {30, 16, 99, 0, false, 0, true, 1};
+    board_t* boards[3];
+    for (int t=0; t<3; t++) {
+        params.threads = threads[t];
+        boards[t] = board_new(&params);
+        CHECK(boards[t] != NULL);
+        if (!boards[t]) {
+            return;
+        }
+    }
+    for (uint64_t seed=1; seed<=5; seed++) {
+        for (int t=0; t<3; t++) {
+            board_reset(boards[t], seed);
+            board_reveal(boards[t], 4, 4);
+        }
+        size_t differ = 0;
+        for (int y=0; y<params.height; y++) {
+            for (int x=0; x<params.width; x++) {
+                cell_t mine = board_peek(boards[0], x, y) & CELL_MINE;
+                differ += mine != (board_peek(boards[1], x, y) & CELL_MINE);
+                differ += mine != (board_peek(boards[2], x, y) & CELL_MINE);
+            }
+        }
+        if (differ) {
+            printf("no-guess seed %llu: layouts differ by thread count\n", (unsigned long long)seed);
+            failures++;
+        }
+
+        /* The first reveal above already opened the board; replay it */
+        board_t* board = boards[0];
+        solver_t* solver = solver_new(board);
+        size_t num;
+        const coord_t* changed = board_changes(board, &num);
+        solver_update(solver, changed, num);
+        CHECK(play_safe(board, solver) == 0);
+        CHECK(board_status(board) == BOARD_WON);
+        solver_free(solver);
+    }
+    for (int t=0; t<3; t++) {
+        board_free(boards[t]);
+    }
+}
@@ -0,0 +1,406 @@
+/* Benchmarks for the hot paths: mine generation, neighbour counting, flood
+ * fill, solver steps, save/load and, when built with SDL2, draw_cells on a
+ * software renderer. Every benchmark runs on a fixed ladder of board sizes
+ * with fixed seeds, and prints one CSV row per benchmark and size, so two
+ * builds can be compared line by line. Linux only.
+ *
+ *   benchmark [-b name] [-x maxside] [-t seconds] [-d dir]
+ *
+ * Columns: bench,width,height,mines,ops,ns_per_op,min_ns_per_op,cells_per_sec
+ * ns_per_op is the mean over all ops, min_ns_per_op the best rep's, and
+ * cells_per_sec the cells processed divided by the time taken.
+ */
+#define _GNU_SOURCE
+#include <time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "../core/board_impl.h"
+#include "../core/solver.h"
+
+#ifdef BENCH_DRAW
+/* draw_cells and game_t live in the front end; take them as they are */
+#define main game_main
+#include "../main.c"
+#undef main
+#endif
+
+/*============================================================================*/
+
+#define DEFAULT_TIME (0.25)     // seconds spent on each benchmark and size
+#define MIN_REPS (3)
+#define MAX_REPS (100000)
+#define FLOOD_DENSITY (100)     // flood boards have one mine per this many cells
+#define SOLVER_STEPS (10000)    // most solver steps timed per game
+#define BENCH_WINDOW (1600)     // side of the offscreen view in px
+
+/*============================================================================*/
+typedef struct {
+    int width, height, nummines;
+} size_preset_t;
+
+/* Shared by every op of one benchmark and size */
+typedef struct {
+    board_params_t params;
+    board_t* board;
+    const char* dir;    // save files go here
+    int rep;
+} bench_t;
+
+/* Runs one rep and returns the seconds its timed part took. ops starts at
+ * 1 and is raised by reps that time several ops; cells gets the number
+ * of cells processed. */
+typedef struct {
+    const char* name;
+    double (*run)(bench_t* b, size_t* ops, size_t* cells);
+} benchmark_t;
+
+/*============================================================================*/
+double now(void);
+void reset_board(bench_t* b);
+double bench_generate(bench_t* b, size_t* ops, size_t* cells);
+double bench_neighbours(bench_t* b, size_t* ops, size_t* cells);
+double bench_flood(bench_t* b, size_t* ops, size_t* cells);
+double bench_solver(bench_t* b, size_t* ops, size_t* cells);
+double bench_save(bench_t* b, size_t* ops, size_t* cells);
+double bench_save_incremental(bench_t* b, size_t* ops, size_t* cells);
+double bench_load(bench_t* b, size_t* ops, size_t* cells);
+#ifdef BENCH_DRAW
+double bench_draw(bench_t* b, size_t* ops, size_t* cells);
+double bench_draw_zoomed_out(bench_t* b, size_t* ops, size_t* cells);
+double draw_frame(bench_t* b, double zoom, size_t* cells);
+#endif
+/*================================================*/
+
+static const size_preset_t sizes[] = {
+    {9, 9, 10},
+    {16, 16, 40},
+    {30, 16, 99},
+    {100, 100, 1500},
+    {1000, 1000, 150000},
+    {10000, 10000, 15000000},
+};
+
+static const benchmark_t benchmarks[] = {
+    {"generate", bench_generate},
+    {"neighbours", bench_neighbours},
+    {"flood", bench_flood},
+    {"solver", bench_solver},
+    {"save", bench_save},
+    {"save_incremental", bench_save_incremental},
+    {"load", bench_load},
+#ifdef BENCH_DRAW
+    {"draw", bench_draw},
+    {"draw_zoomed_out", bench_draw_zoomed_out},
+#endif
+};
+
+int
+main(int argc, char** argv) {
+    const char* only = NULL;
+    const char* dir = "/tmp";
+    long maxside = 10000;
+    double budget = DEFAULT_TIME;
+
+    for (int i=1; i<argc; i++) {
+        if (i+1 >= argc) {
+            only = NULL;
+            maxside = -1;
+            break;
+        }
+        if (strcmp(argv[i], "-b") == 0) {
+            only = argv[++i];
+        } else if (strcmp(argv[i], "-x") == 0) {
+            maxside = strtol(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "-t") == 0) {
+            budget = strtod(argv[++i], NULL);
+        } else if (strcmp(argv[i], "-d") == 0) {
+            dir = argv[++i];
+        } else {
+            maxside = -1;
+            break;
+        }
+    }
+    if (maxside < 9 || budget <= 0) {
+        printf("Usage: %s [-b name] [-x maxside] [-t seconds] [-d dir]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    printf("bench,width,height,mines,ops,ns_per_op,min_ns_per_op,cells_per_sec\n");
+    for (size_t k=0; k<sizeof(benchmarks)/sizeof(benchmarks[0]); k++) {
+        const benchmark_t* bm = &benchmarks[k];
+        if (only && strcmp(only, bm->name) != 0) {
+            continue;
+        }
+        for (size_t s=0; s<sizeof(sizes)/sizeof(sizes[0]); s++) {
+            if (sizes[s].width > maxside || sizes[s].height > maxside) {
+                continue;
+            }
+            bench_t b = {{sizes[s].width, sizes[s].height, sizes[s].nummines, 1, false, 0, false, 1},
+                         NULL, dir, 0};
+            b.board = board_new(&b.params);
+            if (!b.board) {
+                printf("Error allocating a %dx%d board\n", b.params.width, b.params.height);
+                return EXIT_FAILURE;
+            }
+
+            /* Fixed seeds, so every build times the same boards. Untimed
+             * setup can dwarf the op on big boards, so wall time is capped
+             * too; a single rep over budget is measured once. */
+            double total = 0.0, best = 0.0;
+            double wallstart = now();
+            size_t numops = 0, cells = 0;
+            for (b.rep=0; b.rep<MAX_REPS; b.rep++) {
+                if (b.rep >= MIN_REPS && (total >= budget || now() - wallstart >= 20*budget)) {
+                    break;
+                }
+                size_t ops = 1, n = 0;
+                double t = bm->run(&b, &ops, &n);
+                total += t;
+                numops += ops;
+                cells += n;
+                best = b.rep == 0 ? t / ops : MIN(best, t / ops);
+                if (b.rep == 0 && t > budget) {
+                    b.rep++;
+                    break;
+                }
+            }
+            printf("%s,%d,%d,%d,%zu,%.0f,%.0f,%.0f\n", bm->name, b.params.width, b.params.height,
+                   b.params.nummines, numops, total / numops * 1e9, best * 1e9,
+                   total > 0 ? cells / total : 0.0);
+            fflush(stdout);
+            board_free(b.board);
+        }
+    }
+    for (int i=0; i<2; i++) {
+        char path[4096];
+        snprintf(path, sizeof(path), "%s/bench%d.msb", dir, i);
+        remove(path);
+    }
+    return EXIT_SUCCESS;
+}
+
+double
+now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+void
+reset_board(bench_t* b) {
+    /* A fresh layout for this rep, with the centre kept clear for the
+     * first click */
+    board_reset(b->board, (uint64_t)b->rep + 1);
+    generate_mines(b->board, b->params.width/2, b->params.height/2);
+    generate_touching_details(b->board);
+}
+
+double
+bench_generate(bench_t* b, size_t* ops, size_t* cells) {
+    board_reset(b->board, (uint64_t)b->rep + 1);
+    double start = now();
+    generate_mines(b->board, b->params.width/2, b->params.height/2);
+    double t = now() - start;
+    *cells = (size_t)b->params.width * b->params.height;
+    return t;
+}
+
+double
+bench_neighbours(bench_t* b, size_t* ops, size_t* cells) {
+    if (b->rep == 0) {
+        reset_board(b);
+    }
+    double start = now();
+    generate_touching_details(b->board);
+    double t = now() - start;
+    *cells = (size_t)b->params.width * b->params.height;
+    return t;
+}
+
+double
+bench_flood(bench_t* b, size_t* ops, size_t* cells) {
+    /* One click opening a sparse board, so the fill dominates. The
+     * layout is made once; later reps hide the cells again. */
+    if (b->rep == 0) {
+        board_free(b->board);
+        b->params.nummines = (int)MAX(1, (size_t)b->params.width * b->params.height / FLOOD_DENSITY);
+        b->board = board_new(&b->params);
+        if (!b->board) {
+            printf("Error allocating a %dx%d board\n", b->params.width, b->params.height);
+            exit(EXIT_FAILURE);
+        }
+        reset_board(b);
+    } else {
+        size_t n = (size_t)b->params.width * b->params.height;
+        for (size_t i=0; i<n; i++) {
+            b->board->cells[i] &= CELL_MINE | CELL_COUNT;
+        }
+        b->board->numrevealed = 0;
+        b->board->status = BOARD_PLAYING;
+    }
+    double start = now();
+    *cells = board_reveal(b->board, b->params.width/2, b->params.height/2);
+    return now() - start;
+}
+
+double
+bench_solver(bench_t* b, size_t* ops, size_t* cells) {
+    /* Plays from the first click on solver moves only; one op is one
+     * solver update plus the pick of the next safe cell */
+    solver_t* solver = solver_new(b->board);
+    if (!solver) {
+        printf("Error allocating the solver\n");
+        exit(EXIT_FAILURE);
+    }
+    const coord_t* changed;
+    size_t num, steps = 0;
+    coord_t c = {b->params.width/2, b->params.height/2};
+    double t = 0.0;
+
+    reset_board(b);
+    *cells = 0;
+    while (board_status(b->board) == BOARD_PLAYING && steps < SOLVER_STEPS) {
+        board_reveal(b->board, c.x, c.y);
+        changed = board_changes(b->board, &num);
+        double start = now();
+        solver_update(solver, changed, num);
+        bool found = solver_next_safe(solver, &c);
+        t += now() - start;
+        *cells += num;
+        steps++;
+        if (!found) {
+            break;
+        }
+    }
+    solver_free(solver);
+    *ops = MAX(steps, 1);
+    return t;
+}
+
+double
+bench_save(bench_t* b, size_t* ops, size_t* cells) {
+    /* A full write each rep: saving to the other of two files copies the
+     * whole store, then maps the new file */
+    char path[4096];
+    if (b->rep == 0) {
+        reset_board(b);
+        board_reveal(b->board, b->params.width/2, b->params.height/2);
+    }
+    snprintf(path, sizeof(path), "%s/bench%d.msb", b->dir, b->rep % 2);
+    double start = now();
+    if (!board_save(b->board, path)) {
+        printf("Error saving %s\n", path);
+        exit(EXIT_FAILURE);
+    }
+    double t = now() - start;
+    *cells = (size_t)b->params.width * b->params.height;
+    return t;
+}
+
+double
+bench_save_incremental(bench_t* b, size_t* ops, size_t* cells) {
+    /* One flag and a save of the mapped file it went into */
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/bench0.msb", b->dir);
+    if (b->rep == 0) {
+        reset_board(b);
+        if (!board_save(b->board, path)) {
+            printf("Error saving %s\n", path);
+            exit(EXIT_FAILURE);
+        }
+    }
+    board_flag(b->board, b->rep % b->params.width, 0);
+    double start = now();
+    if (!board_save(b->board, path)) {
+        printf("Error saving %s\n", path);
+        exit(EXIT_FAILURE);
+    }
+    double t = now() - start;
+    *cells = 1;
+    return t;
+}
+
+double
+bench_load(bench_t* b, size_t* ops, size_t* cells) {
+    /* Open and close; cell pages are only faulted in as played */
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/bench0.msb", b->dir);
+    if (b->rep == 0) {
+        /* Saved from a throwaway board, so the file is not mapped twice */
+        reset_board(b);
+        if (!board_save(b->board, path)) {
+            printf("Error saving %s\n", path);
+            exit(EXIT_FAILURE);
+        }
+        board_free(b->board);
+        b->board = board_new(&b->params);
+        if (!b->board) {
+            printf("Error allocating a %dx%d board\n", b->params.width, b->params.height);
+            exit(EXIT_FAILURE);
+        }
+    }
+    double start = now();
+    board_t* board = board_load(path);
+    if (!board) {
+        printf("Error loading %s\n", path);
+        exit(EXIT_FAILURE);
+    }
+    board_free(board);
+    double t = now() - start;
+    *cells = (size_t)b->params.width * b->params.height;
+    return t;
+}
+
+#ifdef BENCH_DRAW
+double
+bench_draw(bench_t* b, size_t* ops, size_t* cells) {
+    return draw_frame(b, 1.0, cells);
+}
+
+double
+bench_draw_zoomed_out(bench_t* b, size_t* ops, size_t* cells) {
+    return draw_frame(b, MIN_ZOOM, cells);
+}
+
+double
+draw_frame(bench_t* b, double zoom, size_t* cells) {
+    /* A full redraw of a BENCH_WINDOW square view into a software
+     * renderer, half the board revealed */
+    static game_t game;
+    static SDL_Surface* surface;
+    if (!game.render) {
+        surface = SDL_CreateRGBSurfaceWithFormat(0, BENCH_WINDOW, BENCH_WINDOW, 32, SDL_PIXELFORMAT_ARGB8888);
+        game.render = surface ? SDL_CreateSoftwareRenderer(surface) : NULL;
+        game.perf = perf_new();
+        if (!game.render || !game.perf) {
+            printf("Error creating the software renderer: %s\n", SDL_GetError());
+            exit(EXIT_FAILURE);
+        }
+        init_tx(&game);
+        game.winw = game.winh = BENCH_WINDOW;
+        game.target = SDL_CreateTexture(game.render, SDL_PIXELFORMAT_ARGB8888,
+                                        SDL_TEXTUREACCESS_TARGET, game.winw, game.winh);
+    }
+    if (b->rep == 0) {
+        reset_board(b);
+        for (int y=0; y<b->params.height; y++) {
+            for (int x=0; x<b->params.width/2; x++) {
+                b->board->cells[(size_t)y*b->params.width + x] |= CELL_REVEALED;
+            }
+        }
+    }
+    game.board = b->board;
+    game.camera = (camera_t){0.0, 0.0, zoom};
+    game.redraw = SDL_TRUE;
+
+    double start = now();
+    draw_cells(&game);
+    double t = now() - start;
+    coord_t first, last;
+    visible_cells(&game, &first, &last);
+    *cells = (size_t)(last.x - first.x + 1) * (last.y - first.y + 1);
+    return t;
+}
+#endif
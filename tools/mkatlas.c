@@ -0,0 +1,92 @@
+/* Packs square PNG sprites side by side into one RGBA atlas and writes it
+ * out as a C header, so the game starts without opening or decoding any
+ * image. Sprites are placed in the order given, which must match the
+ * SPRITE_* order in main.c; the makefile's atlas target does that.
+ *
+ *   mkatlas out.h sprite.png...
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <png.h>
+
+/*============================================================================*/
+int load_sprite(const char* path, png_bytep atlas, int size, int slot, int numsprites);
+/*================================================*/
+
+int
+main(int argc, char** argv) {
+    if (argc < 3) {
+        printf("Usage: %s out.h sprite.png...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    int numsprites = argc - 2;
+
+    /* The first sprite sets the cell size */
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&image, argv[2])) {
+        printf("Error reading %s: %s\n", argv[2], image.message);
+        return EXIT_FAILURE;
+    }
+    int size = (int)image.height;
+    png_image_free(&image);
+
+    size_t bytes = (size_t)numsprites * size * size * 4;
+    png_bytep atlas = malloc(bytes);
+    if (!atlas) {
+        printf("Error allocating a %dx%d atlas\n", numsprites*size, size);
+        return EXIT_FAILURE;
+    }
+    for (int i=0; i<numsprites; i++) {
+        if (load_sprite(argv[i+2], atlas, size, i, numsprites)) {
+            free(atlas);
+            return EXIT_FAILURE;
+        }
+    }
+
+    FILE* out = fopen(argv[1], "w");
+    if (!out) {
+        printf("Error creating %s\n", argv[1]);
+        free(atlas);
+        return EXIT_FAILURE;
+    }
+    fprintf(out, "/* Generated by tools/mkatlas from resources/pngs, do not edit; run make atlas\n"
+                 " * after changing a sprite. RGBA bytes, rows top to bottom. */\n\n");
+    fprintf(out, "#define ATLAS_WIDTH (%d)\n#define ATLAS_HEIGHT (%d)\n\n", numsprites*size, size);
+    fprintf(out, "static const uint8_t atlas_pixels[ATLAS_WIDTH*ATLAS_HEIGHT*4] = {\n");
+    for (size_t i=0; i<bytes; i++) {
+        fprintf(out, "%s0x%02x,%s", i % 16 ? " " : "    ", atlas[i], i % 16 == 15 || i+1 == bytes ? "\n" : "");
+    }
+    fprintf(out, "};\n");
+    free(atlas);
+    if (fclose(out)) {
+        printf("Error writing %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+int
+load_sprite(const char* path, png_bytep atlas, int size, int slot, int numsprites) {
+    /* Decodes one sprite straight into its slot of the atlas */
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&image, path)) {
+        printf("Error reading %s: %s\n", path, image.message);
+        return 1;
+    }
+    if ((int)image.width != size || (int)image.height != size) {
+        printf("Error: %s is %ux%u, sprites are %dx%d\n", path, image.width, image.height, size, size);
+        png_image_free(&image);
+        return 1;
+    }
+    image.format = PNG_FORMAT_RGBA;
+    if (!png_image_finish_read(&image, NULL, atlas + (size_t)slot*size*4, numsprites*size*4, NULL)) {
+        printf("Error decoding %s: %s\n", path, image.message);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,135 @@
+/* Headless replay player: plays a recorded game at full speed, checking
+ * every keyframe and the mine layout against the live board, so recorded
+ * games double as regression tests for the core. With -k it seeks to a
+ * move and prints the board there instead.
+ *
+ *   replay file [-k move] [-q]
+ */
+#define _GNU_SOURCE
+#include <time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../core/board.h"
+#include "../core/replay.h"
+
+/*============================================================================*/
+void print_board(board_t* board);
+double now(void);
+/*================================================*/
+
+int
+main(int argc, char** argv) {
+    const char* path = NULL;
+    long seek = -1;
+    int quiet = 0;
+
+    for (int i=1; i<argc; i++) {
+        if (strcmp(argv[i], "-k") == 0 && i+1 < argc) {
+            char* end;
+            seek = strtol(argv[++i], &end, 10);
+            if (*end != '\0' || seek < 0) {
+                path = NULL;
+                break;
+            }
+        } else if (strcmp(argv[i], "-q") == 0) {
+            quiet = 1;
+        } else {
+            path = argv[i];
+        }
+    }
+    if (!path) {
+        printf("Usage: %s file [-k move] [-q]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    replay_t* replay = replay_open(path);
+    if (!replay) {
+        printf("Error reading replay %s\n", path);
+        return EXIT_FAILURE;
+    }
+    const board_params_t* params = replay_params(replay);
+    board_t* board = board_new(params);
+    if (!board) {
+        printf("Error allocating a %dx%d board\n", params->width, params->height);
+        replay_close(replay);
+        return EXIT_FAILURE;
+    }
+
+    int status = EXIT_SUCCESS;
+    if (seek >= 0) {
+        double start = now();
+        if ((size_t)seek > replay_length(replay) || !replay_seek(replay, board, (size_t)seek)) {
+            printf("Error seeking to move %ld of %zu\n", seek, replay_length(replay));
+            status = EXIT_FAILURE;
+        } else {
+            printf("move %ld of %zu, seek took %.3f ms\n", seek, replay_length(replay), (now() - start) * 1e3);
+            print_board(board);
+        }
+    } else {
+        replay_event_t event;
+        size_t moves = 0;
+        double start = now();
+        if (!replay_seek(replay, board, 0)) {
+            printf("Error reading the start of the replay\n");
+            status = EXIT_FAILURE;
+        }
+        while (status == EXIT_SUCCESS && replay_step(replay, board, &event)) {
+            moves++;
+            if (!quiet) {
+                printf("%8u ms  %s (%d, %d)\n", event.ms,
+                       event.action == REPLAY_FLAG ? "flag  " : event.action == REPLAY_CHORD ? "chord " : "reveal",
+                       event.x, event.y);
+            }
+            if (!replay_verify(replay, board)) {
+                printf("Mismatch after move %zu\n", moves);
+                status = EXIT_FAILURE;
+                break;
+            }
+        }
+        double elapsed = now() - start;
+        board_status_t result = board_status(board);
+        printf("board           %dx%d, %d mines, seed %llu\n", params->width, params->height,
+               params->nummines, (unsigned long long)params->seed);
+        printf("moves           %zu of %zu\n", moves, replay_length(replay));
+        printf("result          %s\n", result == BOARD_WON ? "won" : result == BOARD_LOST ? "lost" : "unfinished");
+        printf("moves/sec       %.0f\n", elapsed > 0 ? moves / elapsed : 0.0);
+        if (moves != replay_length(replay)) {
+            status = EXIT_FAILURE;
+        }
+    }
+
+    board_free(board);
+    replay_close(replay);
+    return status;
+}
+
+void
+print_board(board_t* board) {
+    /* One character per cell: digits and spaces for revealed cells, F for
+     * flags, * for a revealed mine, # for hidden */
+    const board_params_t* params = board_params(board);
+    if (params->infinite) {
+        return;
+    }
+    for (int y=0; y<params->height; y++) {
+        for (int x=0; x<params->width; x++) {
+            cell_t cell = board_peek(board, x, y);
+            char c = '#';
+            if (cell & CELL_REVEALED) {
+                c = (cell & CELL_MINE) ? '*' : (cell & CELL_COUNT) ? '0' + (cell & CELL_COUNT) : ' ';
+            } else if (cell & CELL_FLAG) {
+                c = 'F';
+            }
+            putchar(c);
+        }
+        putchar('\n');
+    }
+}
+
+double
+now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
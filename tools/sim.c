@@ -0,0 +1,522 @@
+/* Batch simulator: plays N seeded games on every core with a pluggable
+ * strategy and prints aggregate stats. Linux only (pthreads).
+ *
+ *   sim [-n games] [-t threads] [-w width] [-h height] [-m mines]
+ *       [-s seed] [-S strategy] [-g]
+ */
+#define _GNU_SOURCE
+#include <time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "../core/board.h"
+#include "../core/rng.h"
+#include "../core/solver.h"
+#include "../core/prob.h"
+
+/*============================================================================*/
+
+#define DEFAULT_GAMES (100000)
+#define ARENA_MIN (1 << 20)     // smallest per-thread scratch arena
+#define ARENA_PER_CELL (64)     // scratch bytes a strategy may use per cell
+
+/*============================================================================*/
+/* Bump allocator reset before every game, so the hot loop never mallocs */
+typedef struct {
+    uint8_t* base;
+    size_t used, cap;
+} arena_t;
+
+typedef enum {
+    MOVE_REVEAL,
+    MOVE_FLAG,
+    MOVE_CHORD,
+    MOVE_NONE,          // strategy gave up
+} action_t;
+
+typedef struct worker worker_t;
+
+/* A strategy sets up per-game state in the worker's arena, is told about
+ * every change set, and picks the next move. The engines it asks for are
+ * created once per worker, before its first game. */
+typedef struct {
+    const char* name;
+    bool solver, prob;  // engines the strategy uses
+    void* (*start)(worker_t* worker);
+    void (*update)(void* state, board_t* board, const coord_t* changed, size_t num);
+    action_t (*move)(void* state, board_t* board, rng_t* rng, coord_t* cell);
+} strategy_t;
+
+typedef struct {
+    pthread_mutex_t lock;
+    long next, end;     // games [next, end) still queued on this worker
+} queue_t;
+
+typedef struct {
+    long games, wins;
+    long long clicks;
+    double seconds;     // summed time spent inside games
+} stats_t;
+
+typedef struct sim sim_t;
+
+struct worker {
+    sim_t* sim;
+    int id;
+    queue_t queue;
+    arena_t arena;
+    board_t* board;
+    solver_t* solver;   // reset between games, freed when the worker exits
+    prob_t* prob;
+    rng_t rng;          // picks steal victims; each game has its own
+    stats_t stats;
+    pthread_t thread;
+    bool running;       // thread was started and must be joined
+};
+
+struct sim {
+    board_params_t params;
+    const strategy_t* strategy;
+    long numgames;
+    int numworkers;
+    worker_t* workers;
+};
+
+/*============================================================================*/
+int parse_args(int argc, char** argv, sim_t* sim);
+void* arena_alloc(arena_t* arena, size_t size);
+int take_game(worker_t* worker, long* game);
+void* run_worker(void* arg);
+void play_game(worker_t* worker, long game);
+void* random_start(worker_t* worker);
+void random_update(void* state, board_t* board, const coord_t* changed, size_t num);
+action_t random_move(void* state, board_t* board, rng_t* rng, coord_t* cell);
+void* solver_start(worker_t* worker);
+void solver_strategy_update(void* state, board_t* board, const coord_t* changed, size_t num);
+action_t solver_move(void* state, board_t* board, rng_t* rng, coord_t* cell);
+void* prob_start(worker_t* worker);
+action_t prob_move(void* state, board_t* board, rng_t* rng, coord_t* cell);
+double now(void);
+
+static const strategy_t strategies[] = {
+    {"random", false, false, random_start, random_update, random_move},
+    {"solver", true, false, solver_start, solver_strategy_update, solver_move},
+    {"prob", true, true, prob_start, solver_strategy_update, prob_move},
+};
+#define NUM_STRATEGIES ((int)(sizeof(strategies) / sizeof(strategies[0])))
+/*================================================*/
+
+int
+main(int argc, char** argv) {
+    sim_t sim = {0};
+    stats_t total = {0};
+
+    if (parse_args(argc, argv, &sim)) {
+        printf("Usage: %s [-n games] [-t threads] [-w width] [-h height] [-m mines] [-s seed] [-S strategy] [-g]\n", argv[0]);
+        printf("Strategies:");
+        for (int i=0; i<NUM_STRATEGIES; i++) {
+            printf(" %s", strategies[i].name);
+        }
+        printf("\n");
+        return EXIT_FAILURE;
+    }
+
+    /* Deal the games out evenly; idle workers steal from busy ones */
+    sim.workers = calloc(sim.numworkers, sizeof(worker_t));
+    if (!sim.workers) {
+        printf("Error allocating %d workers\n", sim.numworkers);
+        return EXIT_FAILURE;
+    }
+    for (int i=0; i<sim.numworkers; i++) {
+        worker_t* w = &sim.workers[i];
+        w->sim = &sim;
+        w->id = i;
+        pthread_mutex_init(&w->queue.lock, NULL);
+        w->queue.next = sim.numgames * i / sim.numworkers;
+        w->queue.end = sim.numgames * (i+1) / sim.numworkers;
+        w->arena.cap = ARENA_MIN + (size_t)ARENA_PER_CELL * sim.params.width * sim.params.height;
+        w->arena.base = malloc(w->arena.cap);
+        w->board = board_new(&sim.params);
+        if (!w->arena.base || !w->board) {
+            printf("Error allocating buffers for worker %d\n", i);
+            return EXIT_FAILURE;
+        }
+        rng_seed(&w->rng, sim.params.seed ^ ((uint64_t)i << 32));
+    }
+
+    /* A worker whose thread fails to start leaves its games to be stolen by
+     * the others; with none started, this thread plays them all */
+    double start = now();
+    int running = 0;
+    for (int i=0; i<sim.numworkers; i++) {
+        worker_t* w = &sim.workers[i];
+        w->running = pthread_create(&w->thread, NULL, run_worker, w) == 0;
+        if (!w->running) {
+            printf("Error starting worker %d, its games go to the others\n", i);
+        }
+        running += w->running;
+    }
+    if (running == 0) {
+        run_worker(&sim.workers[0]);
+    }
+    for (int i=0; i<sim.numworkers; i++) {
+        if (sim.workers[i].running) {
+            pthread_join(sim.workers[i].thread, NULL);
+        }
+    }
+    double elapsed = now() - start;
+
+    /* Only now is no worker left to steal from another's queue */
+    for (int i=0; i<sim.numworkers; i++) {
+        worker_t* w = &sim.workers[i];
+        total.games += w->stats.games;
+        total.wins += w->stats.wins;
+        total.clicks += w->stats.clicks;
+        total.seconds += w->stats.seconds;
+        board_free(w->board);
+        free(w->arena.base);
+        pthread_mutex_destroy(&w->queue.lock);
+    }
+
+    printf("strategy        %s\n", sim.strategy->name);
+    printf("board           %dx%d, %d mines\n", sim.params.width, sim.params.height, sim.params.nummines);
+    printf("threads         %d\n", sim.numworkers);
+    printf("games           %ld\n", total.games);
+    printf("wins            %ld\n", total.wins);
+    printf("win rate        %.4f\n", total.games ? (double)total.wins / total.games : 0.0);
+    printf("clicks/game     %.2f\n", total.games ? (double)total.clicks / total.games : 0.0);
+    printf("us/game         %.3f\n", total.games ? total.seconds * 1e6 / total.games : 0.0);
+    printf("wall seconds    %.3f\n", elapsed);
+    printf("games/sec       %.0f\n", elapsed > 0 ? total.games / elapsed : 0.0);
+
+    free(sim.workers);
+    return EXIT_SUCCESS;
+}
+
+int
+parse_args(int argc, char** argv, sim_t* sim) {
+    board_params_t* params = &sim->params;
+    params->width = 9;
+    params->height = 9;
+    params->nummines = 10;
+    params->seed = 1;
+    sim->numgames = DEFAULT_GAMES;
+    sim->numworkers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    sim->strategy = &strategies[0];
+    for (int i=1; i<argc; i++) {
+        /* No-guess boards, each generated on the worker's own thread */
+        if (strcmp(argv[i], "-g") == 0) {
+            params->noguess = true;
+            params->threads = 1;
+            continue;
+        }
+        if (i+1 >= argc) {
+            return 1;
+        }
+        const char* arg = argv[++i];
+        char* end;
+        if (strcmp(argv[i-1], "-S") == 0) {
+            sim->strategy = NULL;
+            for (int s=0; s<NUM_STRATEGIES; s++) {
+                if (strcmp(arg, strategies[s].name) == 0) {
+                    sim->strategy = &strategies[s];
+                }
+            }
+            if (!sim->strategy) {
+                return 1;
+            }
+            continue;
+        } else if (strcmp(argv[i-1], "-s") == 0) {
+            params->seed = strtoull(arg, &end, 10);
+            if (*end != '\0') {
+                return 1;
+            }
+            continue;
+        }
+        long val = strtol(arg, &end, 10);
+        if (*end != '\0' || val < 1 || val > INT_MAX) {
+            return 1;
+        }
+        if (strcmp(argv[i-1], "-n") == 0) {
+            sim->numgames = val;
+        } else if (strcmp(argv[i-1], "-t") == 0) {
+            sim->numworkers = (int)val;
+        } else if (strcmp(argv[i-1], "-w") == 0) {
+            params->width = (int)val;
+        } else if (strcmp(argv[i-1], "-h") == 0) {
+            params->height = (int)val;
+        } else if (strcmp(argv[i-1], "-m") == 0) {
+            params->nummines = (int)val;
+        } else {
+            return 1;
+        }
+    }
+    if (sim->numworkers < 1) {
+        sim->numworkers = 1;
+    }
+    return (long long)params->nummines >= (long long)params->width * params->height;
+}
+
+void*
+arena_alloc(arena_t* arena, size_t size) {
+    size = (size + 15) & ~(size_t)15;
+    if (arena->used + size > arena->cap) {
+        printf("Error: strategy needs more than %zu arena bytes\n", arena->cap);
+        exit(EXIT_FAILURE);
+    }
+    void* p = arena->base + arena->used;
+    arena->used += size;
+    return p;
+}
+
+int
+take_game(worker_t* worker, long* game) {
+    /* Pops the next game off our own queue. When it is empty, steals the
+     * back half of another worker's queue, starting from a random victim.
+     * Returns 0 once every queue is empty. */
+    sim_t* sim = worker->sim;
+    queue_t* own = &worker->queue;
+
+    pthread_mutex_lock(&own->lock);
+    if (own->next < own->end) {
+        *game = own->next++;
+        pthread_mutex_unlock(&own->lock);
+        return 1;
+    }
+    pthread_mutex_unlock(&own->lock);
+
+    int first = (int)rng_below(&worker->rng, sim->numworkers);
+    for (int i=0; i<sim->numworkers; i++) {
+        worker_t* victim = &sim->workers[(first + i) % sim->numworkers];
+        long lo = 0, hi = 0;
+        if (victim == worker) {
+            continue;
+        }
+        pthread_mutex_lock(&victim->queue.lock);
+        long left = victim->queue.end - victim->queue.next;
+        if (left > 0) {
+            hi = victim->queue.end;
+            lo = hi - (left + 1) / 2;
+            victim->queue.end = lo;
+        }
+        pthread_mutex_unlock(&victim->queue.lock);
+        if (hi > lo) {
+            pthread_mutex_lock(&own->lock);
+            own->next = lo + 1;
+            own->end = hi;
+            pthread_mutex_unlock(&own->lock);
+            *game = lo;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void*
+run_worker(void* arg) {
+    /* The strategy's engines are bound to the worker's board, which is
+     * reset rather than replaced, so they are made once and reset too */
+    worker_t* worker = arg;
+    const strategy_t* strategy = worker->sim->strategy;
+    if (strategy->solver) {
+        worker->solver = solver_new(worker->board);
+    }
+    if (strategy->prob) {
+        worker->prob = prob_new(worker->board, 1);
+    }
+    if ((strategy->solver && !worker->solver) || (strategy->prob && !worker->prob)) {
+        printf("Error allocating engines for worker %d\n", worker->id);
+        exit(EXIT_FAILURE);
+    }
+
+    long game;
+    while (take_game(worker, &game)) {
+        play_game(worker, game);
+    }
+    solver_free(worker->solver);
+    prob_free(worker->prob);
+    worker->solver = NULL;
+    worker->prob = NULL;
+    return NULL;
+}
+
+void
+play_game(worker_t* worker, long game) {
+    sim_t* sim = worker->sim;
+    const strategy_t* strategy = sim->strategy;
+    board_t* board = worker->board;
+    const coord_t* changed;
+    size_t num;
+    double start = now();
+
+    /* Every game has its own seed for the board and for its guesses, so
+     * any game can be replayed alone, whichever worker plays it */
+    uint64_t seed = sim->params.seed + (uint64_t)game * 0x9E3779B97F4A7C15ull;
+    rng_t rng;
+    board_reset(board, seed);
+    rng_seed(&rng, ~seed);
+    worker->arena.used = 0;
+    void* state = strategy->start(worker);
+
+    /* The first click is always the middle of the board */
+    long clicks = 1;
+    board_reveal(board, sim->params.width / 2, sim->params.height / 2);
+    changed = board_changes(board, &num);
+    strategy->update(state, board, changed, num);
+
+    while (board_status(board) == BOARD_PLAYING) {
+        coord_t cell;
+        action_t action = strategy->move(state, board, &rng, &cell);
+        if (action == MOVE_NONE) {
+            break;
+        } else if (action == MOVE_FLAG) {
+            board_flag(board, cell.x, cell.y);
+        } else if (action == MOVE_CHORD) {
+            board_chord(board, cell.x, cell.y);
+        } else {
+            board_reveal(board, cell.x, cell.y);
+        }
+        clicks++;
+        changed = board_changes(board, &num);
+        strategy->update(state, board, changed, num);
+    }
+
+    worker->stats.games++;
+    worker->stats.wins += board_status(board) == BOARD_WON;
+    worker->stats.clicks += clicks;
+    worker->stats.seconds += now() - start;
+}
+
+/*============================================================================*/
+/* Random: reveals a uniformly random hidden cell. Hidden cells are kept in
+ * a list; revealed ones are swapped out lazily when drawn, so each move is
+ * O(1) amortised. */
+typedef struct {
+    coord_t* hidden;
+    size_t numhidden;
+} random_t;
+
+void*
+random_start(worker_t* worker) {
+    const board_params_t* params = board_params(worker->board);
+    size_t n = (size_t)params->width * params->height;
+    random_t* state = arena_alloc(&worker->arena, sizeof(random_t));
+    state->hidden = arena_alloc(&worker->arena, n * sizeof(coord_t));
+    state->numhidden = n;
+    for (size_t i=0; i<n; i++) {
+        state->hidden[i] = (coord_t){(int)(i % params->width), (int)(i / params->width)};
+    }
+    return state;
+}
+
+void
+random_update(void* state, board_t* board, const coord_t* changed, size_t num) {
+    (void)state;
+    (void)board;
+    (void)changed;
+    (void)num;
+}
+
+action_t
+random_move(void* state, board_t* board, rng_t* rng, coord_t* cell) {
+    random_t* r = state;
+    while (r->numhidden > 0) {
+        size_t i = rng_below(rng, r->numhidden);
+        coord_t c = r->hidden[i];
+        if (!(board_peek(board, c.x, c.y) & CELL_REVEALED)) {
+            *cell = c;
+            return MOVE_REVEAL;
+        }
+        r->hidden[i] = r->hidden[--r->numhidden];
+    }
+    return MOVE_NONE;
+}
+
+/*============================================================================*/
+/* Solver: reveals cells the incremental solver proves safe and only
+ * guesses a random hidden cell, never a known mine, when it is stuck. The
+ * solver owns heap memory, so it is the worker's, reset between games
+ * instead of allocated in the hot loop. */
+typedef struct {
+    solver_t* solver;
+    random_t guess;
+} solverbot_t;
+
+void*
+solver_start(worker_t* worker) {
+    solver_reset(worker->solver);
+    solverbot_t* state = arena_alloc(&worker->arena, sizeof(solverbot_t));
+    random_t* guess = random_start(worker);
+    state->solver = worker->solver;
+    state->guess = *guess;
+    return state;
+}
+
+void
+solver_strategy_update(void* state, board_t* board, const coord_t* changed, size_t num) {
+    (void)board;
+    solverbot_t* s = state;
+    solver_update(s->solver, changed, num);
+}
+
+action_t
+solver_move(void* state, board_t* board, rng_t* rng, coord_t* cell) {
+    solverbot_t* s = state;
+    if (solver_next_safe(s->solver, cell)) {
+        return MOVE_REVEAL;
+    }
+    random_t* r = &s->guess;
+    while (r->numhidden > 0) {
+        size_t i = rng_below(rng, r->numhidden);
+        coord_t c = r->hidden[i];
+        if (!(board_peek(board, c.x, c.y) & CELL_REVEALED)
+                && solver_known(s->solver, c.x, c.y) != SOLVER_MINE) {
+            *cell = c;
+            return MOVE_REVEAL;
+        }
+        r->hidden[i] = r->hidden[--r->numhidden];
+    }
+    return MOVE_NONE;
+}
+
+/*============================================================================*/
+/* Prob: the solver's moves, but when stuck it reveals the hidden cell with
+ * the lowest exact mine probability. Games already run one per thread, so
+ * each engine enumerates on its own thread. */
+typedef struct {
+    solverbot_t bot;
+    prob_t* prob;
+} probbot_t;
+
+void*
+prob_start(worker_t* worker) {
+    probbot_t* state = arena_alloc(&worker->arena, sizeof(probbot_t));
+    solverbot_t* bot = solver_start(worker);
+    state->bot = *bot;
+    state->prob = worker->prob;
+    return state;
+}
+
+action_t
+prob_move(void* state, board_t* board, rng_t* rng, coord_t* cell) {
+    probbot_t* s = state;
+    if (solver_next_safe(s->bot.solver, cell)) {
+        return MOVE_REVEAL;
+    }
+    if (prob_compute(s->prob) && prob_best(s->prob, cell)) {
+        return MOVE_REVEAL;
+    }
+    return solver_move(&s->bot, board, rng, cell);
+}
+
+/*============================================================================*/
+
+double
+now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}